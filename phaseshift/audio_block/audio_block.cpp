@@ -9,6 +9,8 @@
 
 #include <string>
 #include <atomic>
+#include <chrono>
+#include <thread>
 #include <functional>
 
 
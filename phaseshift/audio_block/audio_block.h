@@ -11,7 +11,9 @@
 #include <phaseshift/containers/ringbuffer.h>
 #include <phaseshift/utils.h>
 
-#include <acbench/time_elapsed.h>
+#ifdef PHASESHIFT_DEV_PROFILING
+    #include <acbench/time_elapsed.h>
+#endif
 
 #include <string>
 #include <functional>
@@ -10,6 +10,8 @@
 #include <phaseshift/sigproc/window_functions.h>
 #include <phaseshift/sigproc/sigproc.h>
 
+#include <random>
+
 // TODO TODO TODO Remove win_center_idx, like in OLA
 void phaseshift::ol::proc_frame(const phaseshift::vector<float>& in, const phaseshift::ol::proc_status& status, phaseshift::globalcursor_t win_center_idx) {
     (void)in;
@@ -11,6 +11,7 @@
 #include <phaseshift/sigproc/sigproc.h>
 
 #include <limits>
+#include <random>
 
 void phaseshift::ola::proc_frame(const phaseshift::vector<float>& in, phaseshift::vector<float>* pout, const phaseshift::ola::proc_status& status) {
     (void)status;
@@ -9,14 +9,44 @@
 
 #include <cstring>
 #include <cassert>
+#include <cstdio>
 #include <algorithm>
 #include <cstdint>
 #include <limits>
 
+#if !defined(_WIN32)
+    #include <fcntl.h>
+    #include <unistd.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+#endif
+
+namespace {
+
+    // Reading is I/O bound: tell the kernel the access is sequential so it
+    // prefetches the next chunks while the samples are being converted,
+    // whatever chunk_size_max is. (A larger setvbuf buffer would help too but
+    // it cannot be installed once tinywav has consumed the header.)
+    void advise_sequential_read(FILE* f) {
+        #if !defined(_WIN32) && defined(POSIX_FADV_SEQUENTIAL)
+            if (f == nullptr)
+                return;
+            posix_fadvise(fileno(f), 0, 0, POSIX_FADV_SEQUENTIAL);
+            posix_fadvise(fileno(f), 0, 0, POSIX_FADV_WILLNEED);
+        #else
+            (void)f;
+        #endif
+    }
+
+}  // namespace
+
 phaseshift::tinywavfile::tinywavfile(int chunk_size_max) {
     assert(chunk_size_max > 0);
     m_chunk_size_max = chunk_size_max;
-    m_chunk = new float[m_chunk_size_max];
+    // SIMD-aligned so the convert kernels can use aligned loads/stores
+    m_chunk = static_cast<float*>(
+        phaseshift::allocation::aligned_malloc(sizeof(float) * m_chunk_size_max, PHASESHIFT_SIMD_ALIGNMENT));
+    m_convert_ops = &phaseshift::wav_convert_get();
     std::memset(&m_tw, 0, sizeof(m_tw));
 }
 
@@ -28,7 +58,7 @@ void phaseshift::tinywavfile::close() {
 phaseshift::tinywavfile::~tinywavfile() {
     close();
     if (m_chunk != nullptr) {
-        delete[] m_chunk;
+        phaseshift::allocation::aligned_free(m_chunk);
         m_chunk = nullptr;
     }
 }
@@ -97,6 +127,24 @@ phaseshift::tinywavfile_reader::tinywavfile_reader(int chunk_size_max)
     : phaseshift::tinywavfile(chunk_size_max) {
 }
 
+phaseshift::tinywavfile_reader::~tinywavfile_reader() {
+    if (m_extract != nullptr) {
+        phaseshift::allocation::aligned_free(m_extract);
+        m_extract = nullptr;
+    }
+    if (m_chunk_s16 != nullptr) {
+        phaseshift::allocation::aligned_free(m_chunk_s16);
+        m_chunk_s16 = nullptr;
+    }
+    #if !defined(_WIN32)
+        if (m_mapped_addr != nullptr) {
+            munmap(m_mapped_addr, m_mapped_length);
+            m_mapped_addr = nullptr;
+            m_mapped_data = nullptr;
+        }
+    #endif
+}
+
 phaseshift::tinywavfile_reader* phaseshift::tinywavfile_reader_builder::open(const std::string& file_path, int chunk_size_max, int channel_id) {
     phaseshift::tinywavfile_reader_builder builder;
     builder.set_file_path(file_path);
@@ -122,11 +170,43 @@ phaseshift::tinywavfile_reader* phaseshift::tinywavfile_reader_builder::build(ph
         return nullptr;
     }
 
+    advise_sequential_read(pab->m_tw.f);
+
     pab->m_fs = static_cast<float>(pab->m_tw.h.SampleRate);
     pab->m_nbchannels = pab->m_tw.numChannels;
     pab->m_channel_id = m_channel_id;
     pab->m_bits_per_sample = pab->m_tw.h.BitsPerSample;
 
+    // Resolve the channel extraction once from the header
+    if (pab->m_nbchannels == 2)
+        pab->m_extract_fn = &phaseshift::tinywavfile_reader::extract_stereo;
+    else if (pab->m_nbchannels > 2)
+        pab->m_extract_fn = &phaseshift::tinywavfile_reader::extract_generic;
+
+    // Mono IEEE_FLOAT files are already the desired float32 stream on disk:
+    // map them and skip the whole fread+convert pipeline. After
+    // tinywav_open_read the stream is positioned at the data chunk.
+    #if !defined(_WIN32)
+        if ((pab->m_tw.h.AudioFormat == phaseshift::wav::FORMAT_IEEE_FLOAT)
+            && (pab->m_bits_per_sample == 32)
+            && (pab->m_nbchannels == 1)) {
+            long data_start = ftell(pab->m_tw.f);
+            struct stat st;
+            if ((data_start > 0) && (data_start % long(alignof(float)) == 0)
+                && (fstat(fileno(pab->m_tw.f), &st) == 0)
+                && (st.st_size > data_start)) {
+                void* addr = mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fileno(pab->m_tw.f), 0);
+                if (addr != MAP_FAILED) {
+                    pab->m_mapped_addr = addr;
+                    pab->m_mapped_length = static_cast<size_t>(st.st_size);
+                    pab->m_mapped_data = reinterpret_cast<const float*>(static_cast<const char*>(addr) + data_start);
+                    pab->m_mapped_nbframes = std::min<int>(pab->m_tw.numFramesInHeader,
+                        static_cast<int>((st.st_size - data_start) / long(sizeof(float))));
+                }
+            }
+        }
+    #endif
+
     return pab;
 }
 
@@ -137,6 +217,10 @@ phaseshift::tinywavfile_writer::tinywavfile_writer(int chunk_size_max)
 
 phaseshift::tinywavfile_writer::~tinywavfile_writer() {
     close();
+    if (m_planar != nullptr) {
+        phaseshift::allocation::aligned_free(m_planar);
+        m_planar = nullptr;
+    }
 }
 
 void phaseshift::tinywavfile_writer::close() {
@@ -0,0 +1,109 @@
+// Copyright (C) 2025 Gilles Degottex <gilles.degottex@gmail.com> All Rights Reserved.
+//
+// You may use, distribute and modify this code under the
+// terms of the Apache 2.0 license.
+// If you don't have a copy of this license, please visit:
+//     https://github.com/gillesdegottex/phaseshift
+
+#include <phaseshift/audio_block/wav_convert.h>
+
+#include <cmath>
+#include <algorithm>
+#include <mutex>
+
+// Scalar reference kernels. Compiled with the baseline ISA of the build, so
+// the compiler is still free to auto-vectorize them.
+namespace {
+
+    // Fullscale is 1<<15 (not 0x7fff) so the reciprocal is a power of two:
+    // the multiplication is bit-exact and s16->f32->s16 round-trips.
+    constexpr float k_s16_scale = 1.0f/32768.0f;
+
+    void s16_to_flt_scalar(float* dst, const int16_t* src, int size) {
+        for (int n = 0; n < size; ++n)
+            dst[n] = src[n] * k_s16_scale;
+    }
+
+    void flt_to_s16_scalar(int16_t* dst, const float* src, int size) {
+        for (int n = 0; n < size; ++n) {
+            float v = src[n] * 32768.0f;
+            v = std::min(32767.0f, std::max(-32768.0f, v));
+            dst[n] = static_cast<int16_t>(std::lrintf(v));
+        }
+    }
+
+    void flt_to_s32_scalar(int32_t* dst, const float* src, int size) {
+        for (int n = 0; n < size; ++n) {
+            // Use a double intermediate: 2^31-1 is not representable as float
+            double v = static_cast<double>(src[n]) * 2147483648.0;
+            v = std::min(2147483647.0, std::max(-2147483648.0, v));
+            dst[n] = static_cast<int32_t>(std::lrint(v));
+        }
+    }
+
+    void f64_to_flt_scalar(float* dst, const double* src, int size) {
+        for (int n = 0; n < size; ++n)
+            dst[n] = static_cast<float>(src[n]);
+    }
+
+    void flt_extract_2ch_scalar(float* dst, const float* src, int nbframes, int channel) {
+        src += channel;
+        for (int n = 0; n < nbframes; ++n, src += 2)
+            dst[n] = *src;
+    }
+
+    void flt_interleave_2ch_scalar(float* dst, const float* src0, const float* src1, int nbframes) {
+        for (int n = 0; n < nbframes; ++n) {
+            *dst++ = src0[n];
+            *dst++ = src1[n];
+        }
+    }
+
+    const phaseshift::wav_convert_ops g_wav_convert_ops_scalar = {
+        s16_to_flt_scalar,
+        flt_to_s16_scalar,
+        flt_to_s32_scalar,
+        f64_to_flt_scalar,
+        flt_extract_2ch_scalar,
+        flt_interleave_2ch_scalar,
+        "scalar",
+    };
+
+}  // namespace
+
+// ISA-specific tables, each defined in its own translation unit which is
+// compiled with the matching -m flags (see CMakeLists.txt).
+namespace phaseshift {
+    namespace detail {
+        #ifdef PHASESHIFT_WAV_CONVERT_AVX2
+        extern const wav_convert_ops g_wav_convert_ops_avx2;
+        #endif
+        #ifdef PHASESHIFT_WAV_CONVERT_NEON
+        extern const wav_convert_ops g_wav_convert_ops_neon;
+        #endif
+    }  // namespace detail
+}  // namespace phaseshift
+
+const phaseshift::wav_convert_ops& phaseshift::wav_convert_get() {
+    static const phaseshift::wav_convert_ops* selected = nullptr;
+    static std::once_flag selected_once;
+
+    std::call_once(selected_once, []() {
+        selected = &g_wav_convert_ops_scalar;
+
+        // Climb the ladder: keep the best table the running CPU supports.
+        #ifdef PHASESHIFT_WAV_CONVERT_AVX2
+        #if defined(__GNUC__) || defined(__clang__)
+        if (__builtin_cpu_supports("avx2"))
+            selected = &phaseshift::detail::g_wav_convert_ops_avx2;
+        #endif
+        #endif
+
+        // NEON is part of the AArch64 baseline, no runtime check needed.
+        #ifdef PHASESHIFT_WAV_CONVERT_NEON
+        selected = &phaseshift::detail::g_wav_convert_ops_neon;
+        #endif
+    });
+
+    return *selected;
+}
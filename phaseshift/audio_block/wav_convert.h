@@ -0,0 +1,43 @@
+// Copyright (C) 2025 Gilles Degottex <gilles.degottex@gmail.com> All Rights Reserved.
+//
+// You may use, distribute and modify this code under the
+// terms of the Apache 2.0 license.
+// If you don't have a copy of this license, please visit:
+//     https://github.com/gillesdegottex/phaseshift
+//
+// PCM<->float conversion kernels with runtime CPU dispatch.
+// The dispatch follows the audio_convert_init pattern: one table of kernel
+// pointers per ISA, the best one being selected once from the cpu flags.
+// Call sites thus never need ISA #ifdefs.
+
+#ifndef PHASESHIFT_AUDIO_BLOCK_WAV_CONVERT_H_
+#define PHASESHIFT_AUDIO_BLOCK_WAV_CONVERT_H_
+
+#include <cstdint>
+
+namespace phaseshift {
+
+    //! Kernel table for sample format conversions.
+    //  All kernels work on interleaved or deinterleaved data alike, they only
+    //  see flat arrays of `size` samples.
+    struct wav_convert_ops {
+        void (*s16_to_flt)(float* dst, const int16_t* src, int size);
+        void (*flt_to_s16)(int16_t* dst, const float* src, int size);
+        void (*flt_to_s32)(int32_t* dst, const float* src, int size);
+        void (*f64_to_flt)(float* dst, const double* src, int size);
+        //! Extract one channel (0 or 1) from an interleaved stereo stream
+        void (*flt_extract_2ch)(float* dst, const float* src, int nbframes, int channel);
+        //! Interleave two planar channels into a stereo stream
+        void (*flt_interleave_2ch)(float* dst, const float* src0, const float* src1, int nbframes);
+
+        //! Name of the ISA the kernels are compiled for (ex. "scalar", "avx2", "neon")
+        const char* name;
+    };
+
+    //! Return the kernel table matching the running CPU.
+    //  The selection is done once (thread-safe), subsequent calls are a single load.
+    const wav_convert_ops& wav_convert_get();
+
+}  // namespace phaseshift
+
+#endif  // PHASESHIFT_AUDIO_BLOCK_WAV_CONVERT_H_
@@ -0,0 +1,134 @@
+// Copyright (C) 2025 Gilles Degottex <gilles.degottex@gmail.com> All Rights Reserved.
+//
+// You may use, distribute and modify this code under the
+// terms of the Apache 2.0 license.
+// If you don't have a copy of this license, please visit:
+//     https://github.com/gillesdegottex/phaseshift
+//
+// AVX2 kernels for wav_convert. This translation unit is compiled with
+// -mavx2 -mfma (see CMakeLists.txt), it must be entered only after
+// __builtin_cpu_supports("avx2") returned true.
+
+#ifdef PHASESHIFT_WAV_CONVERT_AVX2
+
+#include <phaseshift/audio_block/wav_convert.h>
+
+#include <immintrin.h>
+
+#include <cmath>
+#include <algorithm>
+
+namespace {
+
+    void s16_to_flt_avx2(float* dst, const int16_t* src, int size) {
+        const __m256 scale = _mm256_set1_ps(1.0f/32768.0f);
+        int n = 0;
+        for (; n+8 <= size; n += 8) {
+            __m128i s16 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src+n));
+            __m256i s32 = _mm256_cvtepi16_epi32(s16);
+            _mm256_storeu_ps(dst+n, _mm256_mul_ps(_mm256_cvtepi32_ps(s32), scale));
+        }
+        for (; n < size; ++n)
+            dst[n] = src[n] * (1.0f/32768.0f);
+    }
+
+    void flt_to_s16_avx2(int16_t* dst, const float* src, int size) {
+        const __m256 scale = _mm256_set1_ps(32768.0f);
+        int n = 0;
+        for (; n+16 <= size; n += 16) {
+            __m256i lo = _mm256_cvtps_epi32(_mm256_mul_ps(_mm256_loadu_ps(src+n), scale));
+            __m256i hi = _mm256_cvtps_epi32(_mm256_mul_ps(_mm256_loadu_ps(src+n+8), scale));
+            // packs saturates to [-32768,32767], then fix the 128-bit lane interleaving
+            __m256i s16 = _mm256_packs_epi32(lo, hi);
+            s16 = _mm256_permute4x64_epi64(s16, _MM_SHUFFLE(3, 1, 2, 0));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst+n), s16);
+        }
+        for (; n < size; ++n) {
+            float v = src[n] * 32768.0f;
+            v = std::min(32767.0f, std::max(-32768.0f, v));
+            dst[n] = static_cast<int16_t>(std::lrintf(v));
+        }
+    }
+
+    void flt_to_s32_avx2(int32_t* dst, const float* src, int size) {
+        const __m256 scale = _mm256_set1_ps(2147483648.0f);
+        int n = 0;
+        for (; n+8 <= size; n += 8) {
+            __m256 v = _mm256_mul_ps(_mm256_loadu_ps(src+n), scale);
+            // cvtps2dq returns INT_MIN on overflow; when v >= 2^31 the compare
+            // gives all-ones (-1) which turns that INT_MIN into INT_MAX,
+            // saturating without any branch nor min/max pair.
+            __m256i i = _mm256_cvtps_epi32(v);
+            __m256 mask = _mm256_cmp_ps(v, scale, _CMP_NLT_UQ);
+            i = _mm256_add_epi32(i, _mm256_castps_si256(mask));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst+n), i);
+        }
+        for (; n < size; ++n) {
+            double v = static_cast<double>(src[n]) * 2147483648.0;
+            v = std::min(2147483647.0, std::max(-2147483648.0, v));
+            dst[n] = static_cast<int32_t>(std::lrint(v));
+        }
+    }
+
+    void flt_extract_2ch_avx2(float* dst, const float* src, int nbframes, int channel) {
+        // 8 frames per iteration: gather the even (or odd) lanes of two
+        // vectors then restore the frame order across the 128-bit halves.
+        int n = 0;
+        for (; n+8 <= nbframes; n += 8) {
+            __m256 a = _mm256_loadu_ps(src + 2*n);      // L0 R0 L1 R1 | L2 R2 L3 R3
+            __m256 b = _mm256_loadu_ps(src + 2*n + 8);  // L4 R4 L5 R5 | L6 R6 L7 R7
+            __m256 ch = (channel == 0) ? _mm256_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0))
+                                       : _mm256_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1));
+            __m256d ordered = _mm256_permute4x64_pd(_mm256_castps_pd(ch), _MM_SHUFFLE(3, 1, 2, 0));
+            _mm256_storeu_ps(dst+n, _mm256_castpd_ps(ordered));
+        }
+        for (; n < nbframes; ++n)
+            dst[n] = src[2*n + channel];
+    }
+
+    void flt_interleave_2ch_avx2(float* dst, const float* src0, const float* src1, int nbframes) {
+        int n = 0;
+        for (; n+8 <= nbframes; n += 8) {
+            __m256 a = _mm256_loadu_ps(src0+n);  // L0..L7
+            __m256 b = _mm256_loadu_ps(src1+n);  // R0..R7
+            __m256 lo = _mm256_unpacklo_ps(a, b);  // L0 R0 L1 R1 | L4 R4 L5 R5
+            __m256 hi = _mm256_unpackhi_ps(a, b);  // L2 R2 L3 R3 | L6 R6 L7 R7
+            _mm256_storeu_ps(dst + 2*n,     _mm256_permute2f128_ps(lo, hi, 0x20));
+            _mm256_storeu_ps(dst + 2*n + 8, _mm256_permute2f128_ps(lo, hi, 0x31));
+        }
+        for (; n < nbframes; ++n) {
+            dst[2*n] = src0[n];
+            dst[2*n+1] = src1[n];
+        }
+    }
+
+    void f64_to_flt_avx2(float* dst, const double* src, int size) {
+        int n = 0;
+        for (; n+4 <= size; n += 4)
+            _mm_storeu_ps(dst+n, _mm256_cvtpd_ps(_mm256_loadu_pd(src+n)));
+        for (; n < size; ++n)
+            dst[n] = static_cast<float>(src[n]);
+    }
+
+}  // namespace
+
+namespace phaseshift {
+    namespace detail {
+
+        // extern: a const object at namespace scope is internal by default,
+        // and the selection in wav_convert.cpp must find this one.
+        extern const wav_convert_ops g_wav_convert_ops_avx2;
+        const wav_convert_ops g_wav_convert_ops_avx2 = {
+            s16_to_flt_avx2,
+            flt_to_s16_avx2,
+            flt_to_s32_avx2,
+            f64_to_flt_avx2,
+            flt_extract_2ch_avx2,
+            flt_interleave_2ch_avx2,
+            "avx2",
+        };
+
+    }  // namespace detail
+}  // namespace phaseshift
+
+#endif  // PHASESHIFT_WAV_CONVERT_AVX2
@@ -0,0 +1,115 @@
+// Copyright (C) 2025 Gilles Degottex <gilles.degottex@gmail.com> All Rights Reserved.
+//
+// You may use, distribute and modify this code under the
+// terms of the Apache 2.0 license.
+// If you don't have a copy of this license, please visit:
+//     https://github.com/gillesdegottex/phaseshift
+//
+// NEON kernels for wav_convert. NEON is part of the AArch64 baseline so this
+// translation unit needs no extra compile flags nor runtime check.
+
+#ifdef PHASESHIFT_WAV_CONVERT_NEON
+
+#include <phaseshift/audio_block/wav_convert.h>
+
+#include <arm_neon.h>
+
+#include <cmath>
+#include <algorithm>
+
+namespace {
+
+    void s16_to_flt_neon(float* dst, const int16_t* src, int size) {
+        int n = 0;
+        for (; n+4 <= size; n += 4) {
+            // Fixed-point convert: widen to s32 then scale by 2^-15 in one instruction
+            int32x4_t s32 = vmovl_s16(vld1_s16(src+n));
+            vst1q_f32(dst+n, vcvtq_n_f32_s32(s32, 15));
+        }
+        for (; n < size; ++n)
+            dst[n] = src[n] * (1.0f/32768.0f);
+    }
+
+    void flt_to_s16_neon(int16_t* dst, const float* src, int size) {
+        int n = 0;
+        for (; n+4 <= size; n += 4) {
+            // Convert with 2^15 scale, vqmovn saturates to [-32768,32767]
+            int32x4_t s32 = vcvtq_n_s32_f32(vld1q_f32(src+n), 15);
+            vst1_s16(dst+n, vqmovn_s32(s32));
+        }
+        for (; n < size; ++n) {
+            float v = src[n] * 32768.0f;
+            v = std::min(32767.0f, std::max(-32768.0f, v));
+            dst[n] = static_cast<int16_t>(std::lrintf(v));
+        }
+    }
+
+    void flt_to_s32_neon(int32_t* dst, const float* src, int size) {
+        int n = 0;
+        for (; n+4 <= size; n += 4) {
+            // FCVTZS saturates on overflow, no clamp needed
+            vst1q_s32(dst+n, vcvtq_n_s32_f32(vld1q_f32(src+n), 31));
+        }
+        for (; n < size; ++n) {
+            double v = static_cast<double>(src[n]) * 2147483648.0;
+            v = std::min(2147483647.0, std::max(-2147483648.0, v));
+            dst[n] = static_cast<int32_t>(std::lrint(v));
+        }
+    }
+
+    void flt_extract_2ch_neon(float* dst, const float* src, int nbframes, int channel) {
+        int n = 0;
+        for (; n+4 <= nbframes; n += 4) {
+            // vld2q deinterleaves while loading
+            float32x4x2_t v = vld2q_f32(src + 2*n);
+            vst1q_f32(dst+n, v.val[channel]);
+        }
+        for (; n < nbframes; ++n)
+            dst[n] = src[2*n + channel];
+    }
+
+    void flt_interleave_2ch_neon(float* dst, const float* src0, const float* src1, int nbframes) {
+        int n = 0;
+        for (; n+4 <= nbframes; n += 4) {
+            // vst2q interleaves while storing
+            float32x4x2_t v;
+            v.val[0] = vld1q_f32(src0+n);
+            v.val[1] = vld1q_f32(src1+n);
+            vst2q_f32(dst + 2*n, v);
+        }
+        for (; n < nbframes; ++n) {
+            dst[2*n] = src0[n];
+            dst[2*n+1] = src1[n];
+        }
+    }
+
+    void f64_to_flt_neon(float* dst, const double* src, int size) {
+        int n = 0;
+        for (; n+2 <= size; n += 2)
+            vst1_f32(dst+n, vcvt_f32_f64(vld1q_f64(src+n)));
+        for (; n < size; ++n)
+            dst[n] = static_cast<float>(src[n]);
+    }
+
+}  // namespace
+
+namespace phaseshift {
+    namespace detail {
+
+        // extern: a const object at namespace scope is internal by default,
+        // and the selection in wav_convert.cpp must find this one.
+        extern const wav_convert_ops g_wav_convert_ops_neon;
+        const wav_convert_ops g_wav_convert_ops_neon = {
+            s16_to_flt_neon,
+            flt_to_s16_neon,
+            flt_to_s32_neon,
+            f64_to_flt_neon,
+            flt_extract_2ch_neon,
+            flt_interleave_2ch_neon,
+            "neon",
+        };
+
+    }  // namespace detail
+}  // namespace phaseshift
+
+#endif  // PHASESHIFT_WAV_CONVERT_NEON
@@ -0,0 +1,143 @@
+// Copyright (C) 2025 Gilles Degottex <gilles.degottex@gmail.com> All Rights Reserved.
+//
+// You may use, distribute and modify this code under the
+// terms of the Apache 2.0 license.
+// If you don't have a copy of this license, please visit:
+//     https://github.com/gillesdegottex/phaseshift
+
+#include <phaseshift/audio_block/wav_convert.h>
+
+#include <snitch/snitch.hpp>
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+// Odd sizes on purpose: the vectorized kernels run their unrolled body
+// and finish with the scalar tail, so both paths are compared against
+// the references below through whichever table wav_convert_get() selected.
+
+TEST_CASE("wav_convert_s16_roundtrip", "[wav_convert]") {
+    const phaseshift::wav_convert_ops& ops = phaseshift::wav_convert_get();
+    REQUIRE(ops.name != nullptr);
+
+    const int size = 37;
+    std::vector<int16_t> src(size);
+    uint32_t state = 123456789u;
+    for (int n = 0; n < size; ++n) {
+        state = 1664525u*state + 1013904223u;
+        src[n] = static_cast<int16_t>(state >> 16);
+    }
+    src[0] = -32768;
+    src[1] = 32767;
+    src[2] = 0;
+
+    std::vector<float> flt(size);
+    ops.s16_to_flt(flt.data(), src.data(), size);
+    for (int n = 0; n < size; ++n) {
+        // Fullscale is 1<<15, so the scaling is bit-exact.
+        REQUIRE(flt[n] == src[n] * (1.0f/32768.0f));
+    }
+
+    std::vector<int16_t> back(size);
+    ops.flt_to_s16(back.data(), flt.data(), size);
+    for (int n = 0; n < size; ++n) {
+        REQUIRE(back[n] == src[n]);
+    }
+}
+
+TEST_CASE("wav_convert_flt_to_s16_clamp_rounding", "[wav_convert]") {
+    const phaseshift::wav_convert_ops& ops = phaseshift::wav_convert_get();
+
+    // 19 elements: the clamp values run through the 16-wide body and the
+    // same pattern again through the scalar tail.
+    const int size = 19;
+    std::vector<float> src(size, 0.0f);
+    std::vector<int16_t> expected(size, 0);
+
+    src[0] = 1.0f;              expected[0] = 32767;   // +fullscale saturates
+    src[1] = -1.0f;             expected[1] = -32768;
+    src[2] = 2.0f;              expected[2] = 32767;   // far out of range
+    src[3] = -2.0f;             expected[3] = -32768;
+    src[4] = 32766.5f/32768.0f; expected[4] = 32766;   // round half to even
+    src[5] = 0.5f/32768.0f;     expected[5] = 0;
+    src[6] = 1.5f/32768.0f;     expected[6] = 2;
+    src[7] = -1.5f/32768.0f;    expected[7] = -2;
+    src[16] = 1.0f;             expected[16] = 32767;  // tail
+    src[17] = -2.0f;            expected[17] = -32768;
+    src[18] = 1.5f/32768.0f;    expected[18] = 2;
+
+    std::vector<int16_t> dst(size);
+    ops.flt_to_s16(dst.data(), src.data(), size);
+    for (int n = 0; n < size; ++n) {
+        REQUIRE(dst[n] == expected[n]);
+    }
+}
+
+TEST_CASE("wav_convert_flt_to_s32", "[wav_convert]") {
+    const phaseshift::wav_convert_ops& ops = phaseshift::wav_convert_get();
+
+    const int size = 11;
+    std::vector<float> src(size, 0.0f);
+    std::vector<int32_t> expected(size, 0);
+
+    src[0] = 1.0f;    expected[0] = 2147483647;   // 2^31 saturates to 2^31-1
+    src[1] = -1.0f;   expected[1] = INT32_MIN;
+    src[2] = 2.0f;    expected[2] = 2147483647;
+    src[3] = -2.0f;   expected[3] = INT32_MIN;
+    src[4] = 0.5f;    expected[4] = 1073741824;
+    src[5] = -0.25f;  expected[5] = -536870912;
+    src[9] = 1.0f;    expected[9] = 2147483647;   // tail
+    src[10] = -1.0f;  expected[10] = INT32_MIN;
+
+    std::vector<int32_t> dst(size);
+    ops.flt_to_s32(dst.data(), src.data(), size);
+    for (int n = 0; n < size; ++n) {
+        REQUIRE(dst[n] == expected[n]);
+    }
+}
+
+TEST_CASE("wav_convert_f64_to_flt", "[wav_convert]") {
+    const phaseshift::wav_convert_ops& ops = phaseshift::wav_convert_get();
+
+    const int size = 11;
+    std::vector<double> src(size);
+    for (int n = 0; n < size; ++n) {
+        src[n] = std::sin(0.1*n) - 0.5;
+    }
+
+    std::vector<float> dst(size);
+    ops.f64_to_flt(dst.data(), src.data(), size);
+    for (int n = 0; n < size; ++n) {
+        REQUIRE(dst[n] == static_cast<float>(src[n]));
+    }
+}
+
+TEST_CASE("wav_convert_2ch", "[wav_convert]") {
+    const phaseshift::wav_convert_ops& ops = phaseshift::wav_convert_get();
+
+    const int nbframes = 21;
+    std::vector<float> left(nbframes);
+    std::vector<float> right(nbframes);
+    for (int n = 0; n < nbframes; ++n) {
+        left[n] = static_cast<float>(n);
+        right[n] = static_cast<float>(-n - 1);
+    }
+
+    std::vector<float> inter(2*nbframes);
+    ops.flt_interleave_2ch(inter.data(), left.data(), right.data(), nbframes);
+    for (int n = 0; n < nbframes; ++n) {
+        REQUIRE(inter[2*n] == left[n]);
+        REQUIRE(inter[2*n+1] == right[n]);
+    }
+
+    std::vector<float> back(nbframes);
+    ops.flt_extract_2ch(back.data(), inter.data(), nbframes, 0);
+    for (int n = 0; n < nbframes; ++n) {
+        REQUIRE(back[n] == left[n]);
+    }
+    ops.flt_extract_2ch(back.data(), inter.data(), nbframes, 1);
+    for (int n = 0; n < nbframes; ++n) {
+        REQUIRE(back[n] == right[n]);
+    }
+}
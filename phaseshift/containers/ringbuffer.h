@@ -9,12 +9,19 @@
 #define PHASESHIFT_CONTAINERS_RINGBUFFER_H_
 
 #include <phaseshift/utils.h>
+#include <phaseshift/simd.h>
 #include <acbench/ringbuffer.h>
 
+#include <algorithm>
+#include <cstdint>
 #include <cstring>
 #include <complex>
+#include <fstream>
+#include <type_traits>
+#include <utility>
 
 #include <phaseshift/containers/utils.h>
+#include <phaseshift/containers/vector.h>
 
 namespace phaseshift {
     template<typename T> class vector;
@@ -32,19 +39,256 @@ namespace phaseshift {
         using acbench::ringbuffer<value_type>::push_back;   // Brings all push_back member functions from acbench::ringbuffer
         using acbench::ringbuffer<value_type>::push_front;  // Brings all push_front member functions from acbench::ringbuffer
 
-        //! Convenience function
+     protected:
+        //! Append a contiguous array, resolving the destination wrap once:
+        //! at most two memcpy instead of a per-element copy with wrap checks.
+        inline void push_back_contiguous(const value_type* array, int array_size) {
+            if (array_size <= 0)
+                return;
+
+            // Work on locals, write the cursors back once at the end
+            const int size_max = acbr::m_size_max;
+            value_type* const data = acbr::m_data;
+            int end = acbr::m_end;
+
+            assert(size()+array_size <= size_max);
+
+            int seg1size = std::min(array_size, size_max - end);
+            std::memcpy(data+end, array, seg1size*sizeof(value_type));
+
+            int seg2size = array_size - seg1size;
+            if (seg2size > 0)
+                std::memcpy(data, array+seg1size, seg2size*sizeof(value_type));
+
+            end += array_size;
+            if (end >= size_max)
+                end -= size_max;
+            acbr::m_end = end;
+            acbr::m_size += array_size;
+        }
+
+     private:
+        //! True only for storage allocated by the shadowed resize_allocation
+        //! below (the vector::m_owns pattern): the aligned_free calls here
+        //! must never touch memory an acbench path allocated, since the two
+        //! sides pair different allocators.
+        bool m_owns_storage = false;
+
+     public:
+        //! Shadows the base allocation with the phaseshift aligned allocator,
+        //! same layout as vector::resize_allocation: SIMD alignment, one
+        //! vector of tail slack and trailing cache-guard lines. The run
+        //! kernels then work on aligned storage, and the buffer can cross
+        //! ownership boundaries with a known deleter (the acbench base
+        //! allocates with its own, see release_contiguous_allocation).
+        //! The shadow is not virtual: storage allocated through an acbench
+        //! path (a sized base constructor, or resize_allocation on an
+        //! acbench::ringbuffer&) stays owned by the base, and this class
+        //! then leaves both reallocation and release to the base.
+        inline void resize_allocation(int size_max) {
+            if (!m_owns_storage && acbr::m_data != nullptr) {
+                // Live storage from an acbench path: only the base knows its
+                // deleter, so let it do the whole reallocation and keep the
+                // ownership where it is.
+                acbr::resize_allocation(size_max);
+                return;
+            }
+            phaseshift::allocation::aligned_free(acbr::m_data);
+            acbr::m_data = nullptr;
+            m_owns_storage = false;
+            size_t alloc_size = sizeof(value_type) * size_max;
+            if (alloc_size > 0) {
+                alloc_size += phaseshift::simd::width_f32 * sizeof(float);
+                alloc_size += PHASESHIFT_CACHE_GUARD_LINES * PHASESHIFT_CACHE_LINE_SIZE;
+                acbr::m_data = static_cast<value_type*>(
+                    phaseshift::allocation::aligned_malloc(alloc_size, PHASESHIFT_SIMD_ALIGNMENT));
+                m_owns_storage = acbr::m_data != nullptr;
+            }
+            acbr::m_size_max = size_max;
+            acbr::m_front = 0;
+            acbr::m_end = 0;
+            acbr::m_size = 0;
+        }
+        ~ringbuffer() {
+            if (m_owns_storage) {
+                // The storage was allocated here: free it and leave the base
+                // destructor nothing to release.
+                phaseshift::allocation::aligned_free(acbr::m_data);
+                acbr::m_data = nullptr;
+            }
+            // Otherwise the base destructor releases its own allocation with
+            // its own allocator.
+        }
+
+        //! Release ownership of the storage as one contiguous run, rotating
+        //! it in place first when the content wraps (see normalize()), which
+        //! is free in the common non-wrapped case. Returns {pointer, size};
+        //! the caller takes ownership and must call aligned_free().
+        //! WARNING: After this call, the ring is an empty shell, without allocation.
+        inline std::pair<value_type*, int> release_contiguous_allocation() {
+            assert(m_owns_storage && "release_contiguous_allocation: the caller frees with aligned_free, which only pairs with storage allocated by the shadowed resize_allocation");
+            normalize();
+            value_type* ptr = acbr::m_data;
+            const int sz = acbr::m_size;
+            acbr::m_data = nullptr;
+            m_owns_storage = false;
+            acbr::m_front = 0;
+            acbr::m_end = 0;
+            acbr::m_size = 0;
+            acbr::m_size_max = 0;
+            return {ptr, sz};
+        }
+
+        //! Bulk version of acbench's per-element copy: the source runs are
+        //! resolved once, so the whole push is at most four memcpy.
+        inline void push_back(const phaseshift::ringbuffer<value_type>& rb) {
+            push_back(rb, 0, rb.size());
+        }
+        inline void push_back(const phaseshift::ringbuffer<value_type>& rb, int start, int size) {
+            assert(start >= 0);
+            assert(size <= rb.size() - start);
+
+            if (size <= 0)
+                return;
+
+            const int src_size_max = rb.m_size_max;
+            const value_type* const src_data = rb.m_data;
+
+            int src_begin = rb.m_front + start;
+            if (src_begin >= src_size_max)
+                src_begin -= src_size_max;
+
+            int seg1size = std::min(size, src_size_max - src_begin);
+            push_back_contiguous(src_data+src_begin, seg1size);
+
+            int seg2size = size - seg1size;
+            if (seg2size > 0)
+                push_back_contiguous(src_data, seg2size);
+        }
+
+        //! Copy [start,start+size) into a contiguous array: the wrap is
+        //! resolved once, so the copy is at most two memcpy.
+        inline void copy_to_array(value_type* dst, int start, int size) const {
+            assert(start >= 0);
+            assert(size <= acbr::m_size - start);
+
+            if (size <= 0)
+                return;
+
+            const int size_max = acbr::m_size_max;
+            const value_type* const data = acbr::m_data;
+
+            int src_begin = acbr::m_front + start;
+            if (src_begin >= size_max)
+                src_begin -= size_max;
+
+            int seg1size = std::min(size, size_max - src_begin);
+            std::memcpy(dst, data+src_begin, seg1size*sizeof(value_type));
+
+            int seg2size = size - seg1size;
+            if (seg2size > 0)
+                std::memcpy(dst+seg1size, data, seg2size*sizeof(value_type));
+        }
+
+        //! Shadows the base subscript with a branchless wrap: the ternary
+        //! compiles to a conditional move, so per-element access in the
+        //! non-bulk paths carries no mispredictable branch (and no modulo).
+        inline value_type operator[](int n) const {
+            assert(n < acbr::m_size);
+            int idx = acbr::m_front + n;
+            idx -= (idx >= acbr::m_size_max) ? acbr::m_size_max : 0;
+            return acbr::m_data[idx];
+        }
+        inline value_type& operator[](int n) {
+            assert(n < acbr::m_size);
+            int idx = acbr::m_front + n;
+            idx -= (idx >= acbr::m_size_max) ? acbr::m_size_max : 0;
+            return acbr::m_data[idx];
+        }
+
+        //! Below this size, the segmented branches of the operators are
+        //! cheaper than the rotation of normalize().
+        static constexpr int normalize_size_min = 256;
+
+        //! Rotate the storage so that the content starts at the physical
+        //! beginning of the buffer (m_front==0). Afterwards the whole content
+        //! is one contiguous run, so the bulk operators skip their wrap
+        //! branches entirely. Costs one O(m_size_max) rotation.
+        inline void normalize() {
+            if (acbr::m_front == 0)
+                return;
+            std::rotate(acbr::m_data, acbr::m_data + acbr::m_front, acbr::m_data + acbr::m_size_max);
+            acbr::m_front = 0;
+            acbr::m_end = (acbr::m_size == acbr::m_size_max) ? 0 : acbr::m_size;
+        }
+
+        //! Bulk push from a double array: the destination wrap is resolved
+        //! once and each run is converted with SIMD when value_type is float,
+        //! instead of a per-element push_back with its cursor bookkeeping.
         inline void push_back(const double* array, int array_size) {
+            const int size_max = acbr::m_size_max;
+            value_type* const data = acbr::m_data;
+            int end = acbr::m_end;
+
+            assert(size()+array_size <= size_max);
+
+            int seg1size = std::min(array_size, size_max - end);
+            convert_run(data+end, array, seg1size);
+
+            int seg2size = array_size - seg1size;
+            if (seg2size > 0)
+                convert_run(data, array+seg1size, seg2size);
+
+            end += array_size;
+            if (end >= size_max)
+                end -= size_max;
+            acbr::m_end = end;
+            acbr::m_size += array_size;
+        }
+        //! Dequantize PCM16 samples while pushing. The fullscale is 1<<15 so
+        //! the reciprocal multiply is bit-exact (see audio_block/wav_convert.h).
+        inline void push_back_pcm16(const int16_t* array, int array_size) {
             for (int n=0; n < array_size; ++n)
-                push_back(static_cast<value_type>(array[n]));
+                push_back(static_cast<value_type>(array[n] * (1.0f/32768.0f)));
+        }
+        //! Append count copies of the same value: the destination wrap is
+        //! resolved once and each run is filled in bulk, instead of count
+        //! per-element pushes each paying the cursor bookkeeping.
+        inline void push_back_n(const value_type value, int count) {
+            if (count <= 0)
+                return;
+
+            const int size_max = acbr::m_size_max;
+            value_type* const data = acbr::m_data;
+            int end = acbr::m_end;
+
+            assert(size()+count <= size_max);
+
+            int seg1size = std::min(count, size_max - end);
+            fill_run(data+end, seg1size, value);
+
+            int seg2size = count - seg1size;
+            if (seg2size > 0)
+                fill_run(data, seg2size, value);
+
+            end += count;
+            if (end >= size_max)
+                end -= size_max;
+            acbr::m_end = end;
+            acbr::m_size += count;
+        }
+        //! Shadows the base per-element copy with the two-memcpy version.
+        inline void push_back(const value_type* array, int array_size) {
+            push_back_contiguous(array, array_size);
         }
         inline void push_back(const phaseshift::vector<value_type>& v) {
-            push_back(v.data(), v.size());
+            push_back_contiguous(v.data(), v.size());
         }
         inline void push_back(const phaseshift::vector<value_type>& v, int start, int size) {
             assert(start >= 0);
             // assert(size <= v.size() - start);
             size = std::min(size, v.size() - start);
-            push_back(v.data() + start, size);
+            push_back_contiguous(v.data() + start, size);
         }
         inline void push_front(const phaseshift::vector<value_type>& v) {
             acbench::ringbuffer<T>::push_front(v.data(), v.size());
@@ -58,464 +302,363 @@ namespace phaseshift {
         //         push_back(array[n]);
         // }
 
-        ringbuffer& operator+=(float v) {
-
-            for (int n=0; n < size(); ++n)
-                (*this)[n] += v;
-
-            return *this;
+     protected:
+        //! Apply op on a contiguous run. The restrict pointer and the ivdep
+        //! promise let the compiler vectorize, which the modular subscript of
+        //! operator[] would prevent.
+        template<class op_t>
+        static inline void apply_run(value_type* PHASESHIFT_RESTRICT p, int n, float v, op_t op) {
+            PHASESHIFT_IVDEP
+            for (int i = 0; i < n; ++i)
+                p[i] = op(p[i], v);
         }
-        ringbuffer& operator-=(float v) {
 
-            for (int n=0; n < size(); ++n)
-                (*this)[n] -= v;
-
-            return *this;
+        //! Convert a contiguous double run into the storage type.
+        static inline void convert_run(value_type* PHASESHIFT_RESTRICT pdst, const double* PHASESHIFT_RESTRICT psrc, int n) {
+            if constexpr (std::is_same_v<value_type, float>) {
+                phaseshift::simd::cvt(pdst, psrc, n);
+            } else if constexpr (std::is_same_v<value_type, double>) {
+                std::memcpy(pdst, psrc, n*sizeof(double));
+            } else {
+                PHASESHIFT_IVDEP
+                for (int i = 0; i < n; ++i)
+                    pdst[i] = static_cast<value_type>(psrc[i]);
+            }
         }
-        ringbuffer& operator*=(float v) {
-
-            for (int n=0; n < size(); ++n)
-                (*this)[n] *= v;
 
-            return *this;
+        //! Fill a contiguous run with a broadcast value.
+        static inline void fill_run(value_type* PHASESHIFT_RESTRICT p, int n, const value_type value) {
+            if constexpr (std::is_same_v<value_type, float>) {
+                phaseshift::simd::fill(p, n, value);
+            } else {
+                PHASESHIFT_IVDEP
+                for (int i = 0; i < n; ++i)
+                    p[i] = value;
+            }
         }
-        ringbuffer& operator/=(float v) {
-
-            for (int n=0; n < size(); ++n)
-                (*this)[n] /= v;
 
-            return *this;
+        // Pairwise run helpers: dst[i] op= src[i] over a contiguous run,
+        // SIMD for float, ivdep scalar loop otherwise.
+        static inline void run_add(value_type* PHASESHIFT_RESTRICT pdst, const value_type* PHASESHIFT_RESTRICT psrc, int n) {
+            if constexpr (std::is_same_v<value_type, float>) {
+                phaseshift::simd::add(pdst, psrc, n);
+            } else {
+                PHASESHIFT_IVDEP
+                for (int i = 0; i < n; ++i)
+                    pdst[i] += psrc[i];
+            }
         }
-
-        ringbuffer& operator+=(const phaseshift::vector<value_type>& v) {
-            assert(size() == v.size());
-
-            if (v.size() == 0)
-                return *this;
-
-            if (acbr::m_front+v.size() <= acbr::m_size_max) {
-                // No need to slice it
-
-                value_type* pdata = acbr::m_data+acbr::m_front;
-                value_type* pvdata = v.m_data;
-                for (int n = 0; n < v.size(); ++n)
-                    *pdata++ += *pvdata++;
-
+        static inline void run_sub(value_type* PHASESHIFT_RESTRICT pdst, const value_type* PHASESHIFT_RESTRICT psrc, int n) {
+            if constexpr (std::is_same_v<value_type, float>) {
+                phaseshift::simd::sub(pdst, psrc, n);
             } else {
-                // Need to slice the array into two segments
-
-                // 1st segment: m_end:m_size_max-1
-                int seg1size = acbr::m_size_max - acbr::m_end;
-                value_type* pdata = acbr::m_data+acbr::m_front;
-                value_type* pvdata = v.m_data;
-                for (int n = 0; n < seg1size; ++n)
-                    *pdata++ += *pvdata++;
-
-                // 2nd segment: 0:array_size-seg1size
-                int seg2size = v.size() - seg1size;
-                pdata = acbr::m_data;
-                pvdata = v.m_data + seg1size;
-                for (int n = 0; n < seg2size; ++n)
-                    *pdata++ += *pvdata++;
-
+                PHASESHIFT_IVDEP
+                for (int i = 0; i < n; ++i)
+                    pdst[i] -= psrc[i];
+            }
+        }
+        static inline void run_mul(value_type* PHASESHIFT_RESTRICT pdst, const value_type* PHASESHIFT_RESTRICT psrc, int n) {
+            if constexpr (std::is_same_v<value_type, float>) {
+                phaseshift::simd::mul(pdst, psrc, n);
+            } else {
+                PHASESHIFT_IVDEP
+                for (int i = 0; i < n; ++i)
+                    pdst[i] *= psrc[i];
+            }
+        }
+        static inline void run_div(value_type* PHASESHIFT_RESTRICT pdst, const value_type* PHASESHIFT_RESTRICT psrc, int n) {
+            if constexpr (std::is_same_v<value_type, float>) {
+                phaseshift::simd::div(pdst, psrc, n);
+            } else {
+                PHASESHIFT_IVDEP
+                for (int i = 0; i < n; ++i)
+                    pdst[i] /= psrc[i];
             }
-            return *this;
         }
-        ringbuffer& operator-=(const phaseshift::vector<value_type>& v) {
-            assert(size() == v.size());
-
-            if (v.size() == 0)
-                return *this;
 
-            if (acbr::m_front+v.size() <= acbr::m_size_max) {
-                // No need to slice it
-                value_type* pdata = acbr::m_data+acbr::m_front;
-                value_type* pvdata = v.m_data;
-                for (int n = 0; n < v.size(); ++n)
-                    *pdata++ -= *pvdata++;
+        //! Finiteness scan of one contiguous run (see simd::is_finite).
+        static inline bool run_is_finite(const value_type* p, int n) {
+            if constexpr (std::is_same_v<value_type, float>) {
+                return phaseshift::simd::is_finite(p, n);
+            } else if constexpr (std::is_same_v<value_type, std::complex<float>>) {
+                return phaseshift::simd::is_finite(reinterpret_cast<const float*>(p), 2*n);
+            } else {
+                for (int i = 0; i < n; ++i)
+                    if (std::isnan(p[i]) || std::isinf(p[i]))
+                        return false;
+                return true;
+            }
+        }
 
+        // Ternary run helpers for the fused operations.
+        static inline void run_fma(value_type* PHASESHIFT_RESTRICT pdst, const value_type* PHASESHIFT_RESTRICT pa, const value_type* PHASESHIFT_RESTRICT pb, int n) {
+            if constexpr (std::is_same_v<value_type, float>) {
+                phaseshift::simd::fma(pdst, pa, pb, n);
             } else {
-                // Need to slice the array into two segments
-                int seg1size = acbr::m_size_max - acbr::m_front;
-                value_type* pdata = acbr::m_data+acbr::m_front;
-                value_type* pvdata = v.m_data;
-                for (int n = 0; n < seg1size; ++n)
-                    *pdata++ -= *pvdata++;
-
-                int seg2size = v.size() - seg1size;
-                pdata = acbr::m_data;
-                pvdata = v.m_data + seg1size;
-                for (int n = 0; n < seg2size; ++n)
-                    *pdata++ -= *pvdata++;
+                PHASESHIFT_IVDEP
+                for (int i = 0; i < n; ++i)
+                    pdst[i] = pdst[i]*pa[i] + pb[i];
+            }
+        }
+        static inline void run_mul_div(value_type* PHASESHIFT_RESTRICT pdst, const value_type* PHASESHIFT_RESTRICT pm, const value_type* PHASESHIFT_RESTRICT pv, int n) {
+            if constexpr (std::is_same_v<value_type, float>) {
+                phaseshift::simd::mul_div(pdst, pm, pv, n);
+            } else {
+                PHASESHIFT_IVDEP
+                for (int i = 0; i < n; ++i)
+                    pdst[i] = pdst[i]*pm[i]/pv[i];
             }
-            return *this;
         }
-        ringbuffer& operator-=(const phaseshift::ringbuffer<value_type>& rb) {
-            assert(size() == rb.size());
 
-            if (rb.size() == 0)
-                return *this;
+        //! Pairwise op against a contiguous array: branchless two-run split,
+        //! the second run having zero iterations when the content is
+        //! continuous, so the data-dependent wrap branch disappears.
+        template<class run_t>
+        inline void binop_with_vector(const phaseshift::vector<value_type>& v, run_t run) {
+            const int seg1size = std::min(v.size(), acbr::m_size_max - acbr::m_front);
+            const int seg2size = v.size() - seg1size;
+            run(acbr::m_data+acbr::m_front, v.m_data, seg1size);
+            run(acbr::m_data, v.m_data + seg1size, seg2size);
+        }
+
+        //! Same split for the fused ops taking two contiguous array operands.
+        template<class run_t>
+        inline void ternop_with_vectors(const phaseshift::vector<value_type>& a, const phaseshift::vector<value_type>& b, run_t run) {
+            const int seg1size = std::min(a.size(), acbr::m_size_max - acbr::m_front);
+            const int seg2size = a.size() - seg1size;
+            run(acbr::m_data+acbr::m_front, a.m_data, b.m_data, seg1size);
+            run(acbr::m_data, a.m_data + seg1size, b.m_data + seg1size, seg2size);
+        }
 
-            if (acbr::m_front+rb.size() <= acbr::m_size_max) {
+        //! Pairwise op against the first `size` elements of another ring:
+        //! decompose both contents into contiguous runs and call
+        //! run(pdst, psrc, n) on each. Handles every wrap combination, the
+        //! misaligned both-wrapped case needing three runs.
+        template<class run_t>
+        PHASESHIFT_HOT inline void binop_with_ring(const phaseshift::ringbuffer<value_type>& rb, int size, run_t run) {
+            // In steady state the contents rarely straddle the physical end,
+            // so keep the single-run kernel on the fall-through side.
+            if (PHASESHIFT_LIKELY(acbr::m_front+size <= acbr::m_size_max)) {
                 // Destination is continuous
-                if (rb.m_front+rb.size() <= rb.m_size_max) {
+                if (PHASESHIFT_LIKELY(rb.m_front+size <= rb.m_size_max)) {
                     // Source is also continuous
-                    value_type* pdst = acbr::m_data+acbr::m_front;
-                    value_type* psrc = rb.m_data+rb.m_front;
-                    for (int n = 0; n < rb.size(); ++n)
-                        *pdst++ -= *psrc++;
+                    run(acbr::m_data+acbr::m_front, rb.m_data+rb.m_front, size);
                 } else {
                     // Source wraps around
-                    int seg1size = rb.m_size_max - rb.m_front;
-                    value_type* pdst = acbr::m_data+acbr::m_front;
-                    value_type* psrc = rb.m_data+rb.m_front;
-                    for (int n = 0; n < seg1size; ++n)
-                        *pdst++ -= *psrc++;
-
-                    int seg2size = rb.size() - seg1size;
-                    psrc = rb.m_data;
-                    for (int n = 0; n < seg2size; ++n)
-                        *pdst++ -= *psrc++;
+                    int src_seg1 = rb.m_size_max - rb.m_front;
+                    value_type* PHASESHIFT_RESTRICT pdst = acbr::m_data+acbr::m_front;
+                    run(pdst, rb.m_data+rb.m_front, src_seg1);
+                    run(pdst+src_seg1, rb.m_data, size - src_seg1);
                 }
+            } else if (rb.m_front+size <= rb.m_size_max) {
+                // Destination wraps around, source is continuous
+                int dst_seg1 = acbr::m_size_max - acbr::m_front;
+                const value_type* PHASESHIFT_RESTRICT psrc = rb.m_data+rb.m_front;
+                run(acbr::m_data+acbr::m_front, psrc, dst_seg1);
+                run(acbr::m_data, psrc+dst_seg1, size - dst_seg1);
             } else {
-                // Destination wraps around
-                if (rb.m_front+rb.size() <= rb.m_size_max) {
-                    // Source is continuous
-                    int seg1size = acbr::m_size_max - acbr::m_front;
-                    value_type* pdst = acbr::m_data+acbr::m_front;
-                    value_type* psrc = rb.m_data+rb.m_front;
-                    for (int n = 0; n < seg1size; ++n)
-                        *pdst++ -= *psrc++;
-
-                    int seg2size = rb.size() - seg1size;
-                    pdst = acbr::m_data;
-                    for (int n = 0; n < seg2size; ++n)
-                        *pdst++ -= *psrc++;
+                // Both wrap
+                int dst_seg1 = acbr::m_size_max - acbr::m_front;
+                int src_seg1 = rb.m_size_max - rb.m_front;
+                if (dst_seg1 == src_seg1) {
+                    // Aligned wrap points
+                    run(acbr::m_data+acbr::m_front, rb.m_data+rb.m_front, dst_seg1);
+                    run(acbr::m_data, rb.m_data, size - dst_seg1);
+                } else if (src_seg1 < dst_seg1) {
+                    // Misaligned, source breaks first: three runs
+                    value_type* PHASESHIFT_RESTRICT pdst = acbr::m_data+acbr::m_front;
+                    run(pdst, rb.m_data+rb.m_front, src_seg1);
+                    run(pdst+src_seg1, rb.m_data, dst_seg1 - src_seg1);
+                    run(acbr::m_data, rb.m_data + (dst_seg1 - src_seg1), size - dst_seg1);
                 } else {
-                    // Both wrap - check alignment
-                    int dst_seg1 = acbr::m_size_max - acbr::m_front;
-                    int src_seg1 = rb.m_size_max - rb.m_front;
-                    if (dst_seg1 == src_seg1) {
-                        // Aligned wrap points
-                        value_type* pdst = acbr::m_data+acbr::m_front;
-                        value_type* psrc = rb.m_data+rb.m_front;
-                        for (int n = 0; n < dst_seg1; ++n)
-                            *pdst++ -= *psrc++;
-
-                        int seg2size = rb.size() - dst_seg1;
-                        pdst = acbr::m_data;
-                        psrc = rb.m_data;
-                        for (int n = 0; n < seg2size; ++n)
-                            *pdst++ -= *psrc++;
-                    } else {
-                        // Misaligned - fallback to indexed access
-                        for (int n = 0; n < rb.size(); ++n)
-                            (*this)[n] -= rb[n];
-                    }
+                    // Misaligned, destination breaks first: three runs
+                    const value_type* PHASESHIFT_RESTRICT psrc = rb.m_data+rb.m_front;
+                    run(acbr::m_data+acbr::m_front, psrc, dst_seg1);
+                    run(acbr::m_data, psrc+dst_seg1, src_seg1 - dst_seg1);
+                    run(acbr::m_data + (src_seg1 - dst_seg1), rb.m_data, size - src_seg1);
                 }
             }
-            return *this;
         }
-        ringbuffer& operator*=(const phaseshift::vector<value_type>& v) {
-            assert(size() == v.size());
 
-            if (v.size() == 0)
-                return *this;
+        //! Call fn(ptr, len) on the (at most) two contiguous runs of the ring.
+        template<class fn_t>
+        inline void for_each_run(fn_t fn) {
+            const int rb_size = acbr::m_size;
+            const int front = acbr::m_front;
+            value_type* const data = acbr::m_data;
 
-            if (acbr::m_front+v.size() <= acbr::m_size_max) {
-                // No need to slice it
-                value_type* pdata = acbr::m_data+acbr::m_front;
-                value_type* pvdata = v.m_data;
-                for (int n = 0; n < v.size(); ++n)
-                    *pdata++ *= *pvdata++;
+            int seg1size = std::min(rb_size, acbr::m_size_max - front);
+            fn(data+front, seg1size);
 
-            } else {
-                // Need to slice the array into two segments
-                int seg1size = acbr::m_size_max - acbr::m_front;
-                value_type* pdata = acbr::m_data+acbr::m_front;
-                value_type* pvdata = v.m_data;
-                for (int n = 0; n < seg1size; ++n)
-                    *pdata++ *= *pvdata++;
-
-                int seg2size = v.size() - seg1size;
-                pdata = acbr::m_data;
-                pvdata = v.m_data + seg1size;
-                for (int n = 0; n < seg2size; ++n)
-                    *pdata++ *= *pvdata++;
-            }
-            return *this;
+            int seg2size = rb_size - seg1size;
+            if (PHASESHIFT_UNLIKELY(seg2size > 0))
+                fn(data, seg2size);
         }
-        ringbuffer& operator*=(const phaseshift::ringbuffer<value_type>& rb) {
-            assert(size() == rb.size());
 
-            if (rb.size() == 0)
-                return *this;
+        //! Apply op(x,v) on every element: the ring is decomposed once into
+        //! its (at most) two contiguous runs.
+        template<class op_t>
+        inline void apply_broadcast(float v, op_t op) {
+            for_each_run([&](value_type* p, int n){apply_run(p, n, v, op);});
+        }
 
-            if (acbr::m_front+rb.size() <= acbr::m_size_max) {
-                // Destination is continuous
-                if (rb.m_front+rb.size() <= rb.m_size_max) {
-                    // Source is also continuous
-                    value_type* pdst = acbr::m_data+acbr::m_front;
-                    value_type* psrc = rb.m_data+rb.m_front;
-                    for (int n = 0; n < rb.size(); ++n)
-                        *pdst++ *= *psrc++;
-                } else {
-                    // Source wraps around
-                    int seg1size = rb.m_size_max - rb.m_front;
-                    value_type* pdst = acbr::m_data+acbr::m_front;
-                    value_type* psrc = rb.m_data+rb.m_front;
-                    for (int n = 0; n < seg1size; ++n)
-                        *pdst++ *= *psrc++;
-
-                    int seg2size = rb.size() - seg1size;
-                    psrc = rb.m_data;
-                    for (int n = 0; n < seg2size; ++n)
-                        *pdst++ *= *psrc++;
-                }
-            } else {
-                // Destination wraps around
-                if (rb.m_front+rb.size() <= rb.m_size_max) {
-                    // Source is continuous
-                    int seg1size = acbr::m_size_max - acbr::m_front;
-                    value_type* pdst = acbr::m_data+acbr::m_front;
-                    value_type* psrc = rb.m_data+rb.m_front;
-                    for (int n = 0; n < seg1size; ++n)
-                        *pdst++ *= *psrc++;
-
-                    int seg2size = rb.size() - seg1size;
-                    pdst = acbr::m_data;
-                    for (int n = 0; n < seg2size; ++n)
-                        *pdst++ *= *psrc++;
-                } else {
-                    // Both wrap - check alignment
-                    int dst_seg1 = acbr::m_size_max - acbr::m_front;
-                    int src_seg1 = rb.m_size_max - rb.m_front;
-                    if (dst_seg1 == src_seg1) {
-                        // Aligned wrap points
-                        value_type* pdst = acbr::m_data+acbr::m_front;
-                        value_type* psrc = rb.m_data+rb.m_front;
-                        for (int n = 0; n < dst_seg1; ++n)
-                            *pdst++ *= *psrc++;
-
-                        int seg2size = rb.size() - dst_seg1;
-                        pdst = acbr::m_data;
-                        psrc = rb.m_data;
-                        for (int n = 0; n < seg2size; ++n)
-                            *pdst++ *= *psrc++;
-                    } else {
-                        // Misaligned - fallback to indexed access
-                        for (int n = 0; n < rb.size(); ++n)
-                            (*this)[n] *= rb[n];
-                    }
+     public:
+        PHASESHIFT_HOT ringbuffer& operator+=(float v) {
+            if constexpr (std::is_same_v<value_type, float>)
+                for_each_run([v](float* p, int n){phaseshift::simd::add(p, n, v);});
+            else
+                apply_broadcast(v, [](value_type x, float b){return x + b;});
+            return *this;
+        }
+        PHASESHIFT_HOT ringbuffer& operator-=(float v) {
+            if constexpr (std::is_same_v<value_type, float>)
+                for_each_run([v](float* p, int n){phaseshift::simd::sub(p, n, v);});
+            else
+                apply_broadcast(v, [](value_type x, float b){return x - b;});
+            return *this;
+        }
+        PHASESHIFT_HOT ringbuffer& operator*=(float v) {
+            if (v == 1.0f)
+                return *this;
+            if constexpr (std::is_trivially_copyable_v<value_type>) {
+                if (v == 0.0f) {
+                    // Zeroing is bandwidth-limited: memset beats loading and
+                    // multiplying by zero. (Assumes finite content: x*0 keeps
+                    // nan/inf, which assert_nan_inf treats as a bug anyway.)
+                    for_each_run([](value_type* p, int n){std::memset(static_cast<void*>(p), 0, n*sizeof(value_type));});
+                    return *this;
                 }
             }
+            if constexpr (std::is_same_v<value_type, float>)
+                for_each_run([v](float* p, int n){phaseshift::simd::mul(p, n, v);});
+            else
+                apply_broadcast(v, [](value_type x, float b){return x * b;});
             return *this;
         }
-        ringbuffer& operator/=(const phaseshift::vector<value_type>& v) {
-            assert(size() == v.size());
+        //! Division by a broadcast scalar multiplies by the reciprocal,
+        //! computed once (<1 ulp difference, see phaseshift::simd::div).
+        //! This also reuses the operator*= fast paths for every value_type.
+        PHASESHIFT_HOT ringbuffer& operator/=(float v) {
+            return operator*=(1.0f/v);
+        }
 
-            if (v.size() == 0)
-                return *this;
+        PHASESHIFT_HOT ringbuffer& operator+=(const phaseshift::vector<value_type>& v) {
+            assert(size() == v.size());
+            binop_with_vector(v, run_add);
+            return *this;
+        }
+        PHASESHIFT_HOT ringbuffer& operator-=(const phaseshift::vector<value_type>& v) {
+            assert(size() == v.size());
+            binop_with_vector(v, run_sub);
+            return *this;
+        }
+        PHASESHIFT_HOT ringbuffer& operator-=(const phaseshift::ringbuffer<value_type>& rb) {
+            assert(size() == rb.size());
 
-            if (acbr::m_front+v.size() <= acbr::m_size_max) {
-                // No need to slice it
-                value_type* pdata = acbr::m_data+acbr::m_front;
-                value_type* pvdata = v.m_data;
-                for (int n = 0; n < v.size(); ++n)
-                    *pdata++ /= *pvdata++;
+            // On large buffers, one rotation is cheaper than running the
+            // wrapped destination through the segmented branches.
+            if ((acbr::m_front + rb.size() > acbr::m_size_max) && (rb.size() >= normalize_size_min))
+                normalize();
 
-            } else {
-                // Need to slice the array into two segments
-                int seg1size = acbr::m_size_max - acbr::m_front;
-                value_type* pdata = acbr::m_data+acbr::m_front;
-                value_type* pvdata = v.m_data;
-                for (int n = 0; n < seg1size; ++n)
-                    *pdata++ /= *pvdata++;
-
-                int seg2size = v.size() - seg1size;
-                pdata = acbr::m_data;
-                pvdata = v.m_data + seg1size;
-                for (int n = 0; n < seg2size; ++n)
-                    *pdata++ /= *pvdata++;
-            }
+            binop_with_ring(rb, rb.size(), run_sub);
             return *this;
         }
-        ringbuffer& operator/=(const phaseshift::ringbuffer<value_type>& rb) {
+        PHASESHIFT_HOT ringbuffer& operator*=(const phaseshift::vector<value_type>& v) {
+            assert(size() == v.size());
+            binop_with_vector(v, run_mul);
+            return *this;
+        }
+        PHASESHIFT_HOT ringbuffer& operator*=(const phaseshift::ringbuffer<value_type>& rb) {
             assert(size() == rb.size());
 
-            if (rb.size() == 0)
-                return *this;
+            // On large buffers, one rotation is cheaper than running the
+            // wrapped destination through the segmented branches.
+            if ((acbr::m_front + rb.size() > acbr::m_size_max) && (rb.size() >= normalize_size_min))
+                normalize();
 
-            if (acbr::m_front+rb.size() <= acbr::m_size_max) {
-                // Destination is continuous
-                if (rb.m_front+rb.size() <= rb.m_size_max) {
-                    // Source is also continuous
-                    value_type* pdst = acbr::m_data+acbr::m_front;
-                    value_type* psrc = rb.m_data+rb.m_front;
-                    for (int n = 0; n < rb.size(); ++n)
-                        *pdst++ /= *psrc++;
-                } else {
-                    // Source wraps around
-                    int seg1size = rb.m_size_max - rb.m_front;
-                    value_type* pdst = acbr::m_data+acbr::m_front;
-                    value_type* psrc = rb.m_data+rb.m_front;
-                    for (int n = 0; n < seg1size; ++n)
-                        *pdst++ /= *psrc++;
-
-                    int seg2size = rb.size() - seg1size;
-                    psrc = rb.m_data;
-                    for (int n = 0; n < seg2size; ++n)
-                        *pdst++ /= *psrc++;
-                }
-            } else {
-                // Destination wraps around
-                if (rb.m_front+rb.size() <= rb.m_size_max) {
-                    // Source is continuous
-                    int seg1size = acbr::m_size_max - acbr::m_front;
-                    value_type* pdst = acbr::m_data+acbr::m_front;
-                    value_type* psrc = rb.m_data+rb.m_front;
-                    for (int n = 0; n < seg1size; ++n)
-                        *pdst++ /= *psrc++;
-
-                    int seg2size = rb.size() - seg1size;
-                    pdst = acbr::m_data;
-                    for (int n = 0; n < seg2size; ++n)
-                        *pdst++ /= *psrc++;
-                } else {
-                    // Both wrap - check alignment
-                    int dst_seg1 = acbr::m_size_max - acbr::m_front;
-                    int src_seg1 = rb.m_size_max - rb.m_front;
-                    if (dst_seg1 == src_seg1) {
-                        // Aligned wrap points
-                        value_type* pdst = acbr::m_data+acbr::m_front;
-                        value_type* psrc = rb.m_data+rb.m_front;
-                        for (int n = 0; n < dst_seg1; ++n)
-                            *pdst++ /= *psrc++;
-
-                        int seg2size = rb.size() - dst_seg1;
-                        pdst = acbr::m_data;
-                        psrc = rb.m_data;
-                        for (int n = 0; n < seg2size; ++n)
-                            *pdst++ /= *psrc++;
-                    } else {
-                        // Misaligned - fallback to indexed access
-                        for (int n = 0; n < rb.size(); ++n)
-                            (*this)[n] /= rb[n];
-                    }
-                }
-            }
+            binop_with_ring(rb, rb.size(), run_mul);
             return *this;
         }
-        //! *this /= rb (only first 'size' elements)
-        void divide_equal_range(const phaseshift::ringbuffer<value_type>& rb, int size) {
-            assert(size <= acbr::m_size);
-            assert(size <= rb.m_size);
-
-            if (size == 0)
-                return;
+        PHASESHIFT_HOT ringbuffer& operator/=(const phaseshift::vector<value_type>& v) {
+            assert(size() == v.size());
+            binop_with_vector(v, run_div);
+            return *this;
+        }
+        PHASESHIFT_HOT ringbuffer& operator/=(const phaseshift::ringbuffer<value_type>& rb) {
+            assert(size() == rb.size());
 
-            if (acbr::m_front+size <= acbr::m_size_max) {
-                // The destination segment is continuous
+            // On large buffers, one rotation is cheaper than running the
+            // wrapped destination through the segmented branches.
+            if ((acbr::m_front + rb.size() > acbr::m_size_max) && (rb.size() >= normalize_size_min))
+                normalize();
 
-                if (rb.m_front+size <= rb.size_max()) {
-                    // The source segment is also continuous
-                    value_type* pdst = acbr::m_data+acbr::m_front;
-                    value_type* psrc = rb.m_data+rb.m_front;
-                    for (int n=0; n < size; ++n)
-                        *pdst++ /= *psrc++;
+            binop_with_ring(rb, rb.size(), run_div);
+            return *this;
+        }
+        //! Fused *this = *this*a + b: one sweep of the ring, where a *= pass
+        //! followed by a += pass would load and store every element twice.
+        PHASESHIFT_HOT ringbuffer& fma(const phaseshift::vector<value_type>& a, const phaseshift::vector<value_type>& b) {
+            assert(size() == a.size());
+            assert(size() == b.size());
+            ternop_with_vectors(a, b, run_fma);
+            return *this;
+        }
+        //! Fused *this = *this*m/d, same single-sweep rationale.
+        PHASESHIFT_HOT ringbuffer& mul_then_div(const phaseshift::vector<value_type>& m, const phaseshift::vector<value_type>& d) {
+            assert(size() == m.size());
+            assert(size() == d.size());
+            ternop_with_vectors(m, d, run_mul_div);
+            return *this;
+        }
+        //! True when no element is NaN or Inf: batch exponent-bit scan over
+        //! the contiguous runs with one final branch per run, instead of two
+        //! classification calls per element.
+        inline bool is_finite() const {
+            const int seg1size = std::min(acbr::m_size, acbr::m_size_max - acbr::m_front);
+            const int seg2size = acbr::m_size - seg1size;
+            return run_is_finite(acbr::m_data+acbr::m_front, seg1size)
+                && run_is_finite(acbr::m_data, seg2size);
+        }
 
+        //! In-place reciprocal: *this[i] = 1/*this[i]. Lets a denominator
+        //! ring that is reused across calls be inverted once, so repeated
+        //! divide_equal_range become multiply_equal_range: the loops are
+        //! then multiply-throughput bound instead of divider bound.
+        inline void reciprocal() {
+            for_each_run([](value_type* p, int n) {
+                if constexpr (std::is_same_v<value_type, float>) {
+                    phaseshift::simd::rcp(p, n);
                 } else {
-                    // Destination continuous, source wraps around
-                    int src_seg1 = rb.size_max() - rb.m_front;
-                    value_type* pdst = acbr::m_data+acbr::m_front;
-                    value_type* psrc = rb.m_data+rb.m_front;
-                    for (int n=0; n < src_seg1; ++n)
-                        *pdst++ /= *psrc++;
-
-                    int src_seg2 = size - src_seg1;
-                    psrc = rb.m_data;
-                    for (int n=0; n < src_seg2; ++n)
-                        *pdst++ /= *psrc++;
+                    PHASESHIFT_IVDEP
+                    for (int i = 0; i < n; ++i)
+                        p[i] = value_type(1)/p[i];
                 }
+            });
+        }
+        //! *this /= rb (only first 'size' elements)
+        PHASESHIFT_HOT void divide_equal_range(const phaseshift::ringbuffer<value_type>& rb, int size) {
+            assert(size <= acbr::m_size);
+            assert(size <= rb.m_size);
 
-            } else {
-                // The destination segment wraps around
-
-                if (rb.m_front+size <= rb.size_max()) {
-                    // Destination wraps, source is continuous
-                    int dst_seg1 = acbr::m_size_max - acbr::m_front;
-                    value_type* pdst = acbr::m_data+acbr::m_front;
-                    value_type* psrc = rb.m_data+rb.m_front;
-                    for (int n=0; n < dst_seg1; ++n)
-                        *pdst++ /= *psrc++;
+            binop_with_ring(rb, size, run_div);
+        }
+        //! *this *= rb (only first 'size' elements), the multiply
+        //! counterpart of divide_equal_range for hoisted reciprocals.
+        PHASESHIFT_HOT void multiply_equal_range(const phaseshift::ringbuffer<value_type>& rb, int size) {
+            assert(size <= acbr::m_size);
+            assert(size <= rb.m_size);
 
-                    int dst_seg2 = size - dst_seg1;
-                    pdst = acbr::m_data;
-                    for (int n=0; n < dst_seg2; ++n)
-                        *pdst++ /= *psrc++;
+            binop_with_ring(rb, size, run_mul);
+        }
 
-                } else {
-                    // Both wrap around
-                    int dst_seg1 = acbr::m_size_max - acbr::m_front;
-                    int src_seg1 = rb.size_max() - rb.m_front;
-
-                    if (dst_seg1 == src_seg1) {
-                        // Aligned wrap points - handle 2 segments
-                        value_type* pdst = acbr::m_data + acbr::m_front;
-                        value_type* psrc = rb.m_data + rb.m_front;
-                        for (int n=0; n < dst_seg1; ++n)
-                            *pdst++ /= *psrc++;
-
-                        int seg2size = size - dst_seg1;
-                        pdst = acbr::m_data;
-                        psrc = rb.m_data;
-                        for (int n=0; n < seg2size; ++n)
-                            *pdst++ /= *psrc++;
-
-                    } else if (src_seg1 < dst_seg1) {
-                        // Source breaks first - handle 3 segments
-                        value_type* pdst = acbr::m_data + acbr::m_front;
-                        value_type* psrc = rb.m_data + rb.m_front;
-
-                        // Segment 1: both at start positions, up to source wrap
-                        for (int n=0; n < src_seg1; ++n)
-                            *pdst++ /= *psrc++;
-
-                        // Segment 2: destination continues, source wraps
-                        psrc = rb.m_data;
-                        int seg2size = dst_seg1 - src_seg1;
-                        for (int n=0; n < seg2size; ++n)
-                            *pdst++ /= *psrc++;
-
-                        // Segment 3: destination wraps
-                        pdst = acbr::m_data;
-                        int seg3size = size - dst_seg1;
-                        for (int n=0; n < seg3size; ++n)
-                            *pdst++ /= *psrc++;
-
-                    } else {
-                        // Destination breaks first - handle 3 segments
-                        value_type* pdst = acbr::m_data + acbr::m_front;
-                        value_type* psrc = rb.m_data + rb.m_front;
-
-                        // Segment 1: both at start positions, up to dest wrap
-                        for (int n=0; n < dst_seg1; ++n)
-                            *pdst++ /= *psrc++;
-
-                        // Segment 2: source continues, destination wraps
-                        pdst = acbr::m_data;
-                        int seg2size = src_seg1 - dst_seg1;
-                        for (int n=0; n < seg2size; ++n)
-                            *pdst++ /= *psrc++;
-
-                        // Segment 3: source wraps
-                        psrc = rb.m_data;
-                        int seg3size = size - src_seg1;
-                        for (int n=0; n < seg3size; ++n)
-                            *pdst++ /= *psrc++;
-                    }
-                }
-            }
+        //! Write the content to an already-open binary stream, raw: at most
+        //! two bulk writes instead of one small write per element.
+        inline void binaryfile_write_raw(std::ostream& out) const {
+            const int seg1size = std::min(acbr::m_size, acbr::m_size_max - acbr::m_front);
+            out.write(reinterpret_cast<const char*>(acbr::m_data + acbr::m_front), std::streamsize(seg1size)*sizeof(value_type));
+            const int seg2size = acbr::m_size - seg1size;
+            if (seg2size > 0)
+                out.write(reinterpret_cast<const char*>(acbr::m_data), std::streamsize(seg2size)*sizeof(value_type));
         }
     };
 
@@ -523,12 +666,43 @@ namespace phaseshift {
 
         template<typename value_type>
         inline void binaryfile_write(const std::string& filepath, const phaseshift::ringbuffer<std::complex<value_type>>& array, std::ios_base::openmode mode = std::ios::out | std::ios::binary) {
-            phaseshift::dev::binaryfile_write_generic_complex64(filepath, array, mode);
+            if constexpr (std::is_same_v<value_type, float>) {
+                // The memory layout of std::complex<float> matches the
+                // complex64 file format: write the two content runs raw.
+                assert(filepath.size() > 0);
+                std::ofstream outfile(filepath, mode);
+                assert(outfile.is_open());
+                array.binaryfile_write_raw(outfile);
+                outfile.close();
+            } else {
+                phaseshift::dev::binaryfile_write_generic_complex64(filepath, array, mode);
+            }
         }
-        
+
         template<typename value_type>
         inline void binaryfile_write(const std::string& filepath, const phaseshift::ringbuffer<value_type>& array, std::ios_base::openmode mode = std::ios::out | std::ios::binary) {
-            phaseshift::dev::binaryfile_write_generic_float32(filepath, array, mode);
+            if constexpr (std::is_same_v<value_type, float>) {
+                // float storage matches the float32 file format: write the
+                // two content runs raw instead of element by element.
+                assert(filepath.size() > 0);
+                std::ofstream outfile(filepath, mode);
+                assert(outfile.is_open());
+                array.binaryfile_write_raw(outfile);
+                outfile.close();
+            } else {
+                phaseshift::dev::binaryfile_write_generic_float32(filepath, array, mode);
+            }
+        }
+
+        //! Overload of the generic per-element sweep in phaseshift/utils.h:
+        //! the ring knows its contiguous runs, so the scan is batched.
+        template<typename value_type>
+        inline void signals_check_nan_inf(const phaseshift::ringbuffer<value_type>& array) {
+            #ifndef NDEBUG
+            assert(array.is_finite());
+            #else
+            (void)array;
+            #endif
         }
 
     } // namespace dev
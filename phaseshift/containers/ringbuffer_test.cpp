@@ -12,6 +12,7 @@
 #include <snitch/snitch.hpp>
 
 #include <cmath>
+#include <vector>
 
 static bool approx_equal(float a, float b, float eps = 1e-5f) {
     return std::fabs(a - b) <= eps;
@@ -42,9 +43,7 @@ static void create_wrapped_ringbuffer(phaseshift::ringbuffer<float>& rb, int cap
     rb.clear();
 
     // Push and pop to move the front pointer
-    for (int i = 0; i < wrap_offset; ++i) {
-        rb.push_back(0.0f);
-    }
+    rb.push_back_n(0.0f, wrap_offset);
     rb.pop_front(wrap_offset);
 
     // Now push the actual data
@@ -62,6 +61,27 @@ static void create_vector(phaseshift::vector<float>& v, int size, float start_va
     }
 }
 
+// Compare the whole content against an expected array in one pass.
+// copy_to_array resolves the wrap once, so the check runs over plain
+// contiguous memory instead of one wrap-resolving operator[] per element,
+// and each SECTION ends with a single REQUIRE.
+static bool ringbuffer_approx_equal(const phaseshift::ringbuffer<float>& rb, const float* expected, int n, float eps = 1e-5f) {
+    if (rb.size() != n)
+        return false;
+    std::vector<float> content(n);
+    rb.copy_to_array(content.data(), 0, n);
+    for (int i = 0; i < n; ++i) {
+        if (!approx_equal(content[i], expected[i], eps))
+            return false;
+    }
+    return true;
+}
+// Same, against a constant expected value.
+static bool ringbuffer_approx_equal(const phaseshift::ringbuffer<float>& rb, float expected, int n, float eps = 1e-5f) {
+    std::vector<float> expected_array(n, expected);
+    return ringbuffer_approx_equal(rb, expected_array.data(), n, eps);
+}
+
 // =============================================================================
 // Basic Ringbuffer Operations
 // =============================================================================
@@ -195,6 +215,24 @@ TEST_CASE("ringbuffer_scalar_operators", "[ringbuffer]") {
         REQUIRE(rb[2] == Catch::Approx(6.0f));
     }
 
+    SECTION("operator*= scalar by zero and one") {
+        phaseshift::ringbuffer<float> rb;
+        rb.resize_allocation(5);
+        rb.push_back(1.0f);
+        rb.push_back(2.0f);
+        rb.push_back(3.0f);
+
+        rb *= 1.0f;
+        REQUIRE(rb[0] == Catch::Approx(1.0f));
+        REQUIRE(rb[1] == Catch::Approx(2.0f));
+        REQUIRE(rb[2] == Catch::Approx(3.0f));
+
+        rb *= 0.0f;
+        REQUIRE(rb[0] == 0.0f);
+        REQUIRE(rb[1] == 0.0f);
+        REQUIRE(rb[2] == 0.0f);
+    }
+
     SECTION("operator/= scalar") {
         phaseshift::ringbuffer<float> rb;
         rb.resize_allocation(5);
@@ -308,9 +346,8 @@ TEST_CASE("ringbuffer_vector_operators_wrapped", "[ringbuffer]") {
 
         rb += v;
 
-        for (int i = 0; i < size; ++i) {
-            REQUIRE(rb[i] == Catch::Approx(static_cast<float>(i) + 10.0f + static_cast<float>(i)));
-        }
+        const float expected[size] = {10.0f, 12.0f, 14.0f, 16.0f, 18.0f, 20.0f};
+        REQUIRE(ringbuffer_approx_equal(rb, expected, size));
     }
 
     SECTION("operator-= vector - wrapped") {
@@ -321,9 +358,7 @@ TEST_CASE("ringbuffer_vector_operators_wrapped", "[ringbuffer]") {
 
         rb -= v;
 
-        for (int i = 0; i < size; ++i) {
-            REQUIRE(rb[i] == Catch::Approx(10.0f));
-        }
+        REQUIRE(ringbuffer_approx_equal(rb, 10.0f, size));
     }
 
     SECTION("operator*= vector - wrapped") {
@@ -335,12 +370,8 @@ TEST_CASE("ringbuffer_vector_operators_wrapped", "[ringbuffer]") {
 
         rb *= v;
 
-        REQUIRE(rb[0] == Catch::Approx(2.0f));
-        REQUIRE(rb[1] == Catch::Approx(4.0f));
-        REQUIRE(rb[2] == Catch::Approx(6.0f));
-        REQUIRE(rb[3] == Catch::Approx(8.0f));
-        REQUIRE(rb[4] == Catch::Approx(10.0f));
-        REQUIRE(rb[5] == Catch::Approx(12.0f));
+        const float expected[size] = {2.0f, 4.0f, 6.0f, 8.0f, 10.0f, 12.0f};
+        REQUIRE(ringbuffer_approx_equal(rb, expected, size));
     }
 
     SECTION("operator/= vector - wrapped") {
@@ -358,9 +389,7 @@ TEST_CASE("ringbuffer_vector_operators_wrapped", "[ringbuffer]") {
 
         rb /= v;
 
-        for (int i = 0; i < size; ++i) {
-            REQUIRE(rb[i] == Catch::Approx(6.0f));
-        }
+        REQUIRE(ringbuffer_approx_equal(rb, 6.0f, size));
     }
 }
 
@@ -550,9 +579,7 @@ TEST_CASE("ringbuffer_ringbuffer_operators_dest_continuous_src_wrapped", "[ringb
 
         rb1 /= rb2;
 
-        for (int i = 0; i < size; ++i) {
-            REQUIRE(rb1[i] == Catch::Approx(6.0f));
-        }
+        REQUIRE(ringbuffer_approx_equal(rb1, 6.0f, size));
     }
 }
 
@@ -575,9 +602,7 @@ TEST_CASE("ringbuffer_ringbuffer_operators_both_wrapped_aligned", "[ringbuffer]"
 
         rb1 -= rb2;
 
-        for (int i = 0; i < size; ++i) {
-            REQUIRE(rb1[i] == Catch::Approx(10.0f));
-        }
+        REQUIRE(ringbuffer_approx_equal(rb1, 10.0f, size));
     }
 
     SECTION("operator*= - both wrapped, aligned") {
@@ -592,12 +617,8 @@ TEST_CASE("ringbuffer_ringbuffer_operators_both_wrapped_aligned", "[ringbuffer]"
 
         rb1 *= rb2;
 
-        REQUIRE(rb1[0] == Catch::Approx(2.0f));
-        REQUIRE(rb1[1] == Catch::Approx(4.0f));
-        REQUIRE(rb1[2] == Catch::Approx(6.0f));
-        REQUIRE(rb1[3] == Catch::Approx(8.0f));
-        REQUIRE(rb1[4] == Catch::Approx(10.0f));
-        REQUIRE(rb1[5] == Catch::Approx(12.0f));
+        const float expected[size] = {2.0f, 4.0f, 6.0f, 8.0f, 10.0f, 12.0f};
+        REQUIRE(ringbuffer_approx_equal(rb1, expected, size));
     }
 
     SECTION("operator/= - both wrapped, aligned") {
@@ -615,9 +636,7 @@ TEST_CASE("ringbuffer_ringbuffer_operators_both_wrapped_aligned", "[ringbuffer]"
 
         rb1 /= rb2;
 
-        for (int i = 0; i < size; ++i) {
-            REQUIRE(rb1[i] == Catch::Approx(6.0f));
-        }
+        REQUIRE(ringbuffer_approx_equal(rb1, 6.0f, size));
     }
 }
 
@@ -641,9 +660,7 @@ TEST_CASE("ringbuffer_ringbuffer_operators_both_wrapped_misaligned", "[ringbuffe
 
         rb1 -= rb2;
 
-        for (int i = 0; i < size; ++i) {
-            REQUIRE(rb1[i] == Catch::Approx(10.0f));
-        }
+        REQUIRE(ringbuffer_approx_equal(rb1, 10.0f, size));
     }
 
     SECTION("operator-= - both wrapped, dest breaks first") {
@@ -656,9 +673,7 @@ TEST_CASE("ringbuffer_ringbuffer_operators_both_wrapped_misaligned", "[ringbuffe
 
         rb1 -= rb2;
 
-        for (int i = 0; i < size; ++i) {
-            REQUIRE(rb1[i] == Catch::Approx(10.0f));
-        }
+        REQUIRE(ringbuffer_approx_equal(rb1, 10.0f, size));
     }
 
     SECTION("operator*= - both wrapped, misaligned") {
@@ -673,12 +688,8 @@ TEST_CASE("ringbuffer_ringbuffer_operators_both_wrapped_misaligned", "[ringbuffe
 
         rb1 *= rb2;
 
-        REQUIRE(rb1[0] == Catch::Approx(2.0f));
-        REQUIRE(rb1[1] == Catch::Approx(4.0f));
-        REQUIRE(rb1[2] == Catch::Approx(6.0f));
-        REQUIRE(rb1[3] == Catch::Approx(8.0f));
-        REQUIRE(rb1[4] == Catch::Approx(10.0f));
-        REQUIRE(rb1[5] == Catch::Approx(12.0f));
+        const float expected[size] = {2.0f, 4.0f, 6.0f, 8.0f, 10.0f, 12.0f};
+        REQUIRE(ringbuffer_approx_equal(rb1, expected, size));
     }
 
     SECTION("operator/= - both wrapped, misaligned") {
@@ -696,9 +707,7 @@ TEST_CASE("ringbuffer_ringbuffer_operators_both_wrapped_misaligned", "[ringbuffe
 
         rb1 /= rb2;
 
-        for (int i = 0; i < size; ++i) {
-            REQUIRE(rb1[i] == Catch::Approx(6.0f));
-        }
+        REQUIRE(ringbuffer_approx_equal(rb1, 6.0f, size));
     }
 }
 
@@ -723,12 +732,8 @@ TEST_CASE("ringbuffer_divide_equal_range", "[ringbuffer]") {
 
         rb1.divide_equal_range(rb2, 4);  // Only divide first 4 elements
 
-        REQUIRE(rb1[0] == Catch::Approx(10.0f));
-        REQUIRE(rb1[1] == Catch::Approx(10.0f));
-        REQUIRE(rb1[2] == Catch::Approx(10.0f));
-        REQUIRE(rb1[3] == Catch::Approx(10.0f));
-        REQUIRE(rb1[4] == Catch::Approx(50.0f));  // Unchanged
-        REQUIRE(rb1[5] == Catch::Approx(60.0f));  // Unchanged
+        const float expected[6] = {10.0f, 10.0f, 10.0f, 10.0f, 50.0f, 60.0f};  // Last two unchanged
+        REQUIRE(ringbuffer_approx_equal(rb1, expected, 6));
     }
 
     SECTION("dest continuous, src wrapped") {
@@ -744,9 +749,7 @@ TEST_CASE("ringbuffer_divide_equal_range", "[ringbuffer]") {
 
         rb1.divide_equal_range(rb2, 6);
 
-        for (int i = 0; i < 6; ++i) {
-            REQUIRE(rb1[i] == Catch::Approx(12.0f));
-        }
+        REQUIRE(ringbuffer_approx_equal(rb1, 12.0f, 6));
     }
 
     SECTION("dest wrapped, src continuous") {
@@ -762,9 +765,7 @@ TEST_CASE("ringbuffer_divide_equal_range", "[ringbuffer]") {
 
         rb1.divide_equal_range(rb2, 6);
 
-        for (int i = 0; i < 6; ++i) {
-            REQUIRE(rb1[i] == Catch::Approx(12.0f));
-        }
+        REQUIRE(ringbuffer_approx_equal(rb1, 12.0f, 6));
     }
 
     SECTION("both wrapped, aligned") {
@@ -782,9 +783,7 @@ TEST_CASE("ringbuffer_divide_equal_range", "[ringbuffer]") {
 
         rb1.divide_equal_range(rb2, 6);
 
-        for (int i = 0; i < 6; ++i) {
-            REQUIRE(rb1[i] == Catch::Approx(6.0f));
-        }
+        REQUIRE(ringbuffer_approx_equal(rb1, 6.0f, 6));
     }
 
     SECTION("both wrapped, src breaks first (3 segments)") {
@@ -806,9 +805,7 @@ TEST_CASE("ringbuffer_divide_equal_range", "[ringbuffer]") {
 
         rb1.divide_equal_range(rb2, 6);
 
-        for (int i = 0; i < 6; ++i) {
-            REQUIRE(rb1[i] == Catch::Approx(6.0f));
-        }
+        REQUIRE(ringbuffer_approx_equal(rb1, 6.0f, 6));
     }
 
     SECTION("both wrapped, dest breaks first (3 segments)") {
@@ -827,9 +824,7 @@ TEST_CASE("ringbuffer_divide_equal_range", "[ringbuffer]") {
 
         rb1.divide_equal_range(rb2, 6);
 
-        for (int i = 0; i < 6; ++i) {
-            REQUIRE(rb1[i] == Catch::Approx(6.0f));
-        }
+        REQUIRE(ringbuffer_approx_equal(rb1, 6.0f, 6));
     }
 
     SECTION("partial range") {
@@ -844,11 +839,8 @@ TEST_CASE("ringbuffer_divide_equal_range", "[ringbuffer]") {
 
         rb1.divide_equal_range(rb2, 3);  // Only divide first 3
 
-        REQUIRE(rb1[0] == Catch::Approx(10.0f));
-        REQUIRE(rb1[1] == Catch::Approx(10.0f));
-        REQUIRE(rb1[2] == Catch::Approx(10.0f));
-        REQUIRE(rb1[3] == Catch::Approx(40.0f));  // Unchanged
-        REQUIRE(rb1[4] == Catch::Approx(50.0f));  // Unchanged
+        const float expected[8] = {10.0f, 10.0f, 10.0f, 40.0f, 50.0f, 60.0f, 70.0f, 80.0f};  // Only the first 3 divided
+        REQUIRE(ringbuffer_approx_equal(rb1, expected, 8));
     }
 
     SECTION("zero size does nothing") {
@@ -866,6 +858,22 @@ TEST_CASE("ringbuffer_divide_equal_range", "[ringbuffer]") {
         REQUIRE(rb1[0] == Catch::Approx(10.0f));
         REQUIRE(rb1[1] == Catch::Approx(20.0f));
     }
+
+    SECTION("hoisted reciprocal turns divide into multiply") {
+        phaseshift::ringbuffer<float> rb1, rb2;
+        rb1.resize_allocation(capacity);
+        rb2.resize_allocation(capacity);
+
+        for (int i = 0; i < 6; ++i) {
+            rb1.push_back(static_cast<float>((i+1) * 10));  // 10,20,30,40,50,60
+            rb2.push_back(static_cast<float>(i + 1));  // 1,2,3,4,5,6
+        }
+
+        rb2.reciprocal();
+        rb1.multiply_equal_range(rb2, 6);
+
+        REQUIRE(ringbuffer_approx_equal(rb1, 10.0f, 6, 1e-3f));
+    }
 }
 
 // =============================================================================
@@ -1005,3 +1013,211 @@ TEST_CASE("ringbuffer_push_back_ringbuffer", "[ringbuffer]") {
         }
     }
 }
+
+// =============================================================================
+// Normalize
+// =============================================================================
+
+TEST_CASE("ringbuffer_normalize", "[ringbuffer]") {
+    phaseshift::dev::check_compilation_options();
+
+    SECTION("normalize preserves content of a wrapped ring") {
+        phaseshift::ringbuffer<float> rb;
+        rb.resize_allocation(8);
+
+        // Create a wrapped ring: front at 6, content wraps to the beginning
+        for (int i = 0; i < 6; ++i) rb.push_back(0.0f);
+        rb.pop_front(6);
+        for (int i = 0; i < 5; ++i) rb.push_back(static_cast<float>(i + 1));
+
+        rb.normalize();
+
+        REQUIRE(rb.size() == 5);
+        for (int i = 0; i < 5; ++i) {
+            REQUIRE(rb[i] == Catch::Approx(static_cast<float>(i + 1)));
+        }
+    }
+
+    SECTION("normalize on an already continuous ring is a no-op") {
+        phaseshift::ringbuffer<float> rb;
+        rb.resize_allocation(8);
+        for (int i = 0; i < 4; ++i) rb.push_back(static_cast<float>(i));
+
+        rb.normalize();
+
+        REQUIRE(rb.size() == 4);
+        for (int i = 0; i < 4; ++i) {
+            REQUIRE(rb[i] == Catch::Approx(static_cast<float>(i)));
+        }
+    }
+
+    SECTION("normalize on a full wrapped ring") {
+        const int cap = 8;
+        phaseshift::ringbuffer<float> rb;
+        rb.resize_allocation(cap);
+        for (int i = 0; i < cap; ++i) rb.push_back(0.0f);
+        rb.pop_front(3);
+        for (int i = 0; i < 3; ++i) rb.push_back(static_cast<float>(i + 1));
+
+        rb.normalize();
+
+        REQUIRE(rb.size() == cap);
+        REQUIRE(rb[cap - 3] == Catch::Approx(1.0f));
+        REQUIRE(rb[cap - 2] == Catch::Approx(2.0f));
+        REQUIRE(rb[cap - 1] == Catch::Approx(3.0f));
+
+        // Operators still work after normalization
+        phaseshift::ringbuffer<float> rb2;
+        rb2.resize_allocation(cap);
+        for (int i = 0; i < cap; ++i) rb2.push_back(2.0f);
+        rb *= rb2;
+        REQUIRE(rb[cap - 1] == Catch::Approx(6.0f));
+    }
+}
+
+TEST_CASE("ringbuffer_push_back_n", "[ringbuffer]") {
+    phaseshift::dev::check_compilation_options();
+
+    SECTION("push_back_n on a continuous ring") {
+        phaseshift::ringbuffer<float> rb;
+        rb.resize_allocation(10);
+        rb.push_back_n(3.0f, 7);
+
+        REQUIRE(rb.size() == 7);
+        for (int i = 0; i < 7; ++i) {
+            REQUIRE(rb[i] == Catch::Approx(3.0f));
+        }
+    }
+
+    SECTION("push_back_n across the wrap boundary") {
+        phaseshift::ringbuffer<float> rb;
+        create_wrapped_ringbuffer(rb, 10, 4, 8);  // front at 8, content wraps
+
+        rb.push_back_n(5.0f, 6);
+
+        REQUIRE(rb.size() == 10);
+        for (int i = 0; i < 4; ++i) {
+            REQUIRE(rb[i] == Catch::Approx(static_cast<float>(i)));
+        }
+        for (int i = 4; i < 10; ++i) {
+            REQUIRE(rb[i] == Catch::Approx(5.0f));
+        }
+    }
+}
+
+TEST_CASE("ringbuffer_fused_operators", "[ringbuffer]") {
+    phaseshift::dev::check_compilation_options();
+
+    const int size = 6;
+
+    SECTION("fma - continuous") {
+        phaseshift::ringbuffer<float> rb;
+        rb.resize_allocation(10);
+        for (int i = 0; i < size; ++i) rb.push_back(static_cast<float>(i + 1));  // 1,2,3,4,5,6
+
+        phaseshift::vector<float> a, b;
+        create_vector(a, size, 2.0f);  // 2,3,4,5,6,7
+        create_vector(b, size, 1.0f);  // 1,2,3,4,5,6
+
+        rb.fma(a, b);
+
+        const float expected[size] = {3.0f, 8.0f, 15.0f, 24.0f, 35.0f, 48.0f};
+        REQUIRE(ringbuffer_approx_equal(rb, expected, size));
+    }
+
+    SECTION("fma - wrapped") {
+        phaseshift::ringbuffer<float> rb;
+        create_wrapped_ringbuffer(rb, 10, size, 7, 1.0f);  // 1,2,3,4,5,6
+
+        phaseshift::vector<float> a, b;
+        create_vector(a, size, 2.0f);  // 2,3,4,5,6,7
+        create_vector(b, size, 1.0f);  // 1,2,3,4,5,6
+
+        rb.fma(a, b);
+
+        const float expected[size] = {3.0f, 8.0f, 15.0f, 24.0f, 35.0f, 48.0f};
+        REQUIRE(ringbuffer_approx_equal(rb, expected, size));
+    }
+
+    SECTION("mul_then_div - wrapped") {
+        phaseshift::ringbuffer<float> rb;
+        create_wrapped_ringbuffer(rb, 10, size, 8, 1.0f);  // 1,2,3,4,5,6
+
+        phaseshift::vector<float> m, d;
+        m.resize_allocation(size);
+        for (int i = 0; i < size; ++i) m.push_back(6.0f);
+        create_vector(d, size, 1.0f);  // 1,2,3,4,5,6
+
+        rb.mul_then_div(m, d);
+
+        REQUIRE(ringbuffer_approx_equal(rb, 6.0f, size));
+    }
+}
+
+TEST_CASE("vector_allocation_reuse", "[ringbuffer]") {
+    phaseshift::dev::check_compilation_options();
+
+    SECTION("resize_allocation keeps a large-enough buffer") {
+        phaseshift::vector<float> v;
+        v.resize_allocation(10);
+        v.push_back(1.0f);
+
+        float* pdata = v.data();
+        v.resize_allocation(5);  // covered by the current buffer: no realloc
+
+        REQUIRE(v.data() == pdata);
+        REQUIRE(v.size() == 0);
+        REQUIRE(v.size_max() >= 5);
+    }
+
+    SECTION("reserve grows and preserves the content") {
+        phaseshift::vector<float> v;
+        v.resize_allocation(4);
+        for (int i = 0; i < 4; ++i) v.push_back(static_cast<float>(i));
+
+        v.reserve(16);
+
+        REQUIRE(v.size_max() >= 16);
+        REQUIRE(v.size() == 4);
+        for (int i = 0; i < 4; ++i) {
+            REQUIRE(v[i] == Catch::Approx(static_cast<float>(i)));
+        }
+    }
+}
+
+TEST_CASE("ringbuffer_release_contiguous_allocation", "[ringbuffer]") {
+    phaseshift::dev::check_compilation_options();
+
+    SECTION("non-wrapped content") {
+        phaseshift::ringbuffer<float> rb;
+        rb.resize_allocation(10);
+        for (int i = 0; i < 6; ++i) rb.push_back(static_cast<float>(i));
+
+        auto [data, size] = rb.release_contiguous_allocation();
+
+        REQUIRE(size == 6);
+        REQUIRE(data != nullptr);
+        for (int i = 0; i < 6; ++i) {
+            REQUIRE(data[i] == Catch::Approx(static_cast<float>(i)));
+        }
+        REQUIRE(rb.size() == 0);
+        REQUIRE(rb.size_max() == 0);
+
+        phaseshift::allocation::aligned_free(data);
+    }
+
+    SECTION("wrapped content is linearized") {
+        phaseshift::ringbuffer<float> rb;
+        create_wrapped_ringbuffer(rb, 10, 6, 8, 1.0f);  // 1,2,3,4,5,6 across the wrap
+
+        auto [data, size] = rb.release_contiguous_allocation();
+
+        REQUIRE(size == 6);
+        for (int i = 0; i < 6; ++i) {
+            REQUIRE(data[i] == Catch::Approx(static_cast<float>(1 + i)));
+        }
+        REQUIRE(rb.size() == 0);
+
+        phaseshift::allocation::aligned_free(data);
+    }
+}
@@ -10,9 +10,13 @@
 
 #include <cstdint>
 #include <phaseshift/utils.h>
+#include <phaseshift/simd.h>
 
+#include <algorithm>
 #include <cstring>
+#include <fstream>
 #include <string>
+#include <type_traits>
 #include <vector>
 #include <deque>
 
@@ -59,16 +63,49 @@ namespace phaseshift {
         // must mirror python numpy functions: np.fromfile(filepath, dtype=dtype)
         // TODO(GD) Move to acbench?
 
+        // has_contiguous_data lives in phaseshift/utils.h (dev::) since the
+        // signal reductions there use it too.
+
+        //! Elements per block of the type-coercing write paths: converted
+        //! values are staged on the stack and flushed with one write per
+        //! block, instead of one locked stream write per element.
+        static constexpr int binaryfile_write_block_size = 1024;
+
+        //! Open filepath with a 1 MiB stream buffer, so the block-staged
+        //! dumps coalesce into few large kernel writes instead of one per
+        //! 8 KiB of default buffering. The buffer has to be installed
+        //! before open() and must outlive the stream, hence the out-params.
+        inline void binaryfile_open_buffered(std::ofstream* outfile, std::vector<char>* iobuf, const std::string& filepath, std::ios_base::openmode mode) {
+            iobuf->resize(1u<<20);
+            outfile->rdbuf()->pubsetbuf(iobuf->data(), static_cast<std::streamsize>(iobuf->size()));
+            outfile->open(filepath, mode);
+        }
+
         template<typename array_type>
         inline void binaryfile_write_generic_int32(const std::string& filepath, const array_type& array, std::ios_base::openmode mode = std::ios::out | std::ios::binary) {
             assert(filepath.size() > 0);
 
-            std::ofstream outfile(filepath, mode);
+            std::ofstream outfile;
+            std::vector<char> iobuf;
+            binaryfile_open_buffered(&outfile, &iobuf, filepath, mode);
             assert(outfile.is_open());
 
-            for (int n = 0; n < int(array.size()); ++n) {
-                int32_t value = static_cast<int32_t>(array[n]);
-                outfile.write(reinterpret_cast<char*>(&value), sizeof(int32_t));
+            if constexpr (has_contiguous_data<array_type>::value
+                          && std::is_same_v<typename array_type::value_type, int32_t>) {
+                // Storage already matches the on-disk format: one bulk write.
+                outfile.write(reinterpret_cast<const char*>(array.data()), sizeof(int32_t)*array.size());
+            } else {
+                int32_t block[binaryfile_write_block_size];
+                int fill = 0;
+                for (int n = 0; n < int(array.size()); ++n) {
+                    block[fill++] = static_cast<int32_t>(array[n]);
+                    if (fill == binaryfile_write_block_size) {
+                        outfile.write(reinterpret_cast<const char*>(block), sizeof(int32_t)*fill);
+                        fill = 0;
+                    }
+                }
+                if (fill > 0)
+                    outfile.write(reinterpret_cast<const char*>(block), sizeof(int32_t)*fill);
             }
             outfile.close();
         }
@@ -77,12 +114,39 @@ namespace phaseshift {
         inline void binaryfile_write_generic_float32(const std::string& filepath, const array_type& array, std::ios_base::openmode mode = std::ios::out | std::ios::binary) {
             assert(filepath.size() > 0);
 
-            std::ofstream outfile(filepath, mode);
+            std::ofstream outfile;
+            std::vector<char> iobuf;
+            binaryfile_open_buffered(&outfile, &iobuf, filepath, mode);
             assert(outfile.is_open());
 
-            for (int n = 0; n < int(array.size()); ++n) {
-                float value = static_cast<float>(array[n]);
-                outfile.write(reinterpret_cast<char*>(&value), sizeof(float));
+            if constexpr (has_contiguous_data<array_type>::value
+                          && std::is_same_v<typename array_type::value_type, float>) {
+                // Storage already matches the on-disk format: one bulk write.
+                outfile.write(reinterpret_cast<const char*>(array.data()), sizeof(float)*array.size());
+            } else if constexpr (has_contiguous_data<array_type>::value
+                                 && std::is_same_v<typename array_type::value_type, double>) {
+                // Narrowing from contiguous doubles: SIMD convert each block
+                // (see simd::cvt), then one write per block.
+                float block[binaryfile_write_block_size];
+                const double* src = array.data();
+                const int size = static_cast<int>(array.size());
+                for (int n = 0; n < size; n += binaryfile_write_block_size) {
+                    const int len = std::min(binaryfile_write_block_size, size - n);
+                    phaseshift::simd::cvt(block, src+n, len);
+                    outfile.write(reinterpret_cast<const char*>(block), sizeof(float)*len);
+                }
+            } else {
+                float block[binaryfile_write_block_size];
+                int fill = 0;
+                for (int n = 0; n < int(array.size()); ++n) {
+                    block[fill++] = static_cast<float>(array[n]);
+                    if (fill == binaryfile_write_block_size) {
+                        outfile.write(reinterpret_cast<const char*>(block), sizeof(float)*fill);
+                        fill = 0;
+                    }
+                }
+                if (fill > 0)
+                    outfile.write(reinterpret_cast<const char*>(block), sizeof(float)*fill);
             }
             outfile.close();
         }
@@ -91,14 +155,40 @@ namespace phaseshift {
         inline void binaryfile_write_generic_complex64(const std::string& filepath, const array_type& array, std::ios_base::openmode mode = std::ios::out | std::ios::binary) {
             assert(filepath.size() > 0);
 
-            std::ofstream outfile(filepath, mode);
+            std::ofstream outfile;
+            std::vector<char> iobuf;
+            binaryfile_open_buffered(&outfile, &iobuf, filepath, mode);
             assert(outfile.is_open());
 
-            for (int n = 0; n < int(array.size()); ++n) {
-                float value_real = static_cast<float>(array[n].real());
-                outfile.write(reinterpret_cast<char*>(&value_real), sizeof(float));
-                float value_imag = static_cast<float>(array[n].imag());
-                outfile.write(reinterpret_cast<char*>(&value_imag), sizeof(float));
+            if constexpr (has_contiguous_data<array_type>::value
+                          && std::is_same_v<typename array_type::value_type, std::complex<float>>) {
+                // complex<float> is two packed floats: one bulk write.
+                outfile.write(reinterpret_cast<const char*>(array.data()), sizeof(std::complex<float>)*array.size());
+            } else if constexpr (has_contiguous_data<array_type>::value
+                                 && std::is_same_v<typename array_type::value_type, std::complex<double>>) {
+                // complex<double> is two packed doubles, so the interleaved
+                // real/imag stream narrows like a plain double array.
+                float block[binaryfile_write_block_size];
+                const double* src = reinterpret_cast<const double*>(array.data());
+                const int size = 2*static_cast<int>(array.size());
+                for (int n = 0; n < size; n += binaryfile_write_block_size) {
+                    const int len = std::min(binaryfile_write_block_size, size - n);
+                    phaseshift::simd::cvt(block, src+n, len);
+                    outfile.write(reinterpret_cast<const char*>(block), sizeof(float)*len);
+                }
+            } else {
+                float block[binaryfile_write_block_size];
+                int fill = 0;
+                for (int n = 0; n < int(array.size()); ++n) {
+                    block[fill++] = static_cast<float>(array[n].real());
+                    block[fill++] = static_cast<float>(array[n].imag());
+                    if (fill == binaryfile_write_block_size) {
+                        outfile.write(reinterpret_cast<const char*>(block), sizeof(float)*fill);
+                        fill = 0;
+                    }
+                }
+                if (fill > 0)
+                    outfile.write(reinterpret_cast<const char*>(block), sizeof(float)*fill);
             }
             outfile.close();
         }
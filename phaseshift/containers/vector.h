@@ -9,14 +9,17 @@
 #define PHASESHIFT_CONTAINERS_VECTOR_H_
 
 #include <phaseshift/utils.h>
+#include <phaseshift/simd.h>
 
 #include <Eigen/Dense>
 
 #include <fftscarf.h>
 
+#include <cstdint>
 #include <cstdlib>
 #include <cstring>
 #include <string>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -27,7 +30,28 @@
 // For AVX-512, 64-byte alignment: Define PHASESHIFT_SIMD_ALIGNMENT before including the header or via compiler flags: -DPHASESHIFT_SIMD_ALIGNMENT=64
 // Disable alignment: If you don't need SIMD optimization: -DPHASESHIFT_SIMD_ALIGNMENT=1
 #ifndef PHASESHIFT_SIMD_ALIGNMENT
-#define PHASESHIFT_SIMD_ALIGNMENT 32
+    #if defined(__AVX512F__)
+        // A 64-byte alignment keeps the 512-bit accesses off cache-line splits.
+        #define PHASESHIFT_SIMD_ALIGNMENT 64
+    #else
+        #define PHASESHIFT_SIMD_ALIGNMENT 32
+    #endif
+#endif
+
+// Trailing cache-guard padding for the container allocations.
+// The hardware next-line prefetcher speculatively pulls the cache lines
+// adjacent to an access; without a guard, reads near the buffer tail can drag
+// a neighbouring hot allocation into the cache and create cross-core
+// contention in multi-threaded pipelines. The guard lines are never accessed.
+#ifndef PHASESHIFT_CACHE_LINE_SIZE
+#define PHASESHIFT_CACHE_LINE_SIZE 64
+#endif
+#ifndef PHASESHIFT_CACHE_GUARD_LINES
+#define PHASESHIFT_CACHE_GUARD_LINES 2
+#endif
+
+#if defined(__linux__)
+    #include <sys/mman.h>
 #endif
 
 namespace phaseshift {
@@ -53,7 +77,21 @@ namespace phaseshift {
             #else
                 // std::aligned_alloc requires size to be a multiple of alignment
                 size_t aligned_size = ((size + alignment - 1) / alignment) * alignment;
-                return std::aligned_alloc(alignment, aligned_size);
+                void* ptr = std::aligned_alloc(alignment, aligned_size);
+                #if defined(__linux__) && defined(MADV_HUGEPAGE)
+                    // Buffers spanning at least one huge page: ask the kernel
+                    // for transparent huge pages, which cuts TLB misses on
+                    // large memory-bound sweeps. madvise wants page-aligned
+                    // addresses, so advise the page-aligned interior.
+                    if (ptr != nullptr && aligned_size >= 2u*1024u*1024u) {
+                        const uintptr_t page = 4096u;
+                        uintptr_t beg = (reinterpret_cast<uintptr_t>(ptr) + (page-1)) & ~(page-1);
+                        uintptr_t end = (reinterpret_cast<uintptr_t>(ptr) + aligned_size) & ~(page-1);
+                        if (end > beg)
+                            madvise(reinterpret_cast<void*>(beg), end-beg, MADV_HUGEPAGE);
+                    }
+                #endif
+                return ptr;
             #endif
         }
 
@@ -96,14 +134,17 @@ namespace phaseshift {
      private:
         int m_size = 0;
         T* m_data = nullptr;
+        bool m_owns = true;
 
         inline void destroy() {
             if (m_data != nullptr) {
-                phaseshift::allocation::aligned_free(m_data);
+                if (m_owns)
+                    phaseshift::allocation::aligned_free(m_data);
                 m_data = nullptr;
             }
             m_size = 0;
             m_size_max = 0;
+            m_owns = true;
         }
 
         // Copy constructor is forbidden to avoid implicit calls.
@@ -116,7 +157,19 @@ namespace phaseshift {
         inline void memory_copy(value_type* pdest, const value_type* psrc, int size) {
             if (size==0) return;
             assert(size > 0);
-            std::memcpy(reinterpret_cast<void*>(pdest), reinterpret_cast<const void*>(psrc), sizeof(value_type)*size);
+            // Streams the stores past the cache for copies beyond the LLC
+            // (plain memcpy below the threshold), which covers both segments
+            // of the ringbuffer assignment and the bulk push_back.
+            phaseshift::simd::copy(reinterpret_cast<void*>(pdest), reinterpret_cast<const void*>(psrc), sizeof(value_type)*size);
+        }
+
+        //! Loop bound of the float SIMD kernels below: the whole-vector
+        //! padding is only legal when every operand involved owns its
+        //! allocation and thus carries the tail slack. With a borrowed view
+        //! (view_external) on either side the kernels run the exact length
+        //! and finish with their scalar tails.
+        inline int float_kernel_size(bool all_owned) const {
+            return all_owned ? phaseshift::simd::padded_size(m_size) : m_size;
         }
 
      public:
@@ -127,23 +180,68 @@ namespace phaseshift {
             resize(size_max_and_size);
         }
         void resize_allocation(int size_max) {
-            if (size_max == m_size_max) {
+            // 1 is the documented escape hatch disabling SIMD alignment;
+            // anything else must at least satisfy the element's alignment.
+            static_assert((PHASESHIFT_SIMD_ALIGNMENT == 1) || (PHASESHIFT_SIMD_ALIGNMENT >= alignof(value_type)),
+                          "PHASESHIFT_SIMD_ALIGNMENT is smaller than the element alignment");
+
+            if ((size_max <= m_size_max) && m_owns) {
+                // The current buffer already covers the request: keep it and
+                // only clear the content. Growth-then-shrink call patterns
+                // would otherwise pay a free+malloc round-trip each time.
+                // (A borrowed view is never reused as writable storage.)
                 clear();
                 return;
             }
             destroy();
 
             // Aligned allocation for SIMD optimization (AVX/AVX2 requires 32-byte alignment)
+            size_t alloc_size = sizeof(value_type) * size_max;
+            if (alloc_size > 0) {
+                // One SIMD vector of writable tail slack: the float operators
+                // below round their loop bound up to the vector width
+                // (simd::padded_size), so the kernels overwrite at most these
+                // lanes instead of finishing with a scalar tail loop.
+                alloc_size += phaseshift::simd::width_f32 * sizeof(float);
+                alloc_size += PHASESHIFT_CACHE_GUARD_LINES * PHASESHIFT_CACHE_LINE_SIZE;
+            }
             m_data = static_cast<value_type*>(
-                phaseshift::allocation::aligned_malloc(sizeof(value_type) * size_max, PHASESHIFT_SIMD_ALIGNMENT));
+                phaseshift::allocation::aligned_malloc(alloc_size, PHASESHIFT_SIMD_ALIGNMENT));
             m_size_max = size_max;
 
             m_size = 0;
         }
+        //! Grow the allocation to at least size_max_min without losing the
+        //! content: the stored elements are copied over and size() is kept,
+        //! where resize_allocation() clears.
+        inline void reserve(int size_max_min) {
+            if (size_max_min <= m_size_max)
+                return;
+
+            value_type* old_data = m_data;
+            const int old_size = m_size;
+            const bool old_owns = m_owns;
+
+            size_t alloc_size = sizeof(value_type) * size_max_min;
+            alloc_size += phaseshift::simd::width_f32 * sizeof(float);
+            alloc_size += PHASESHIFT_CACHE_GUARD_LINES * PHASESHIFT_CACHE_LINE_SIZE;
+            m_data = static_cast<value_type*>(
+                phaseshift::allocation::aligned_malloc(alloc_size, PHASESHIFT_SIMD_ALIGNMENT));
+            m_size_max = size_max_min;
+
+            if (old_data != nullptr) {
+                memory_copy(m_data, old_data, old_size);
+                if (old_owns)
+                    phaseshift::allocation::aligned_free(old_data);
+            }
+            m_owns = true;
+            m_size = old_size;
+        }
         // Release ownership of the internal buffer.
         // Returns {pointer, size}. Caller takes ownership and must call aligned_free().
         // WARNING: After this call, the vector is invalid, an empty shell, without allocation.
         inline std::pair<value_type*, int> release_allocation() {
+            assert(m_owns && "release_allocation: cannot transfer ownership of a borrowed view");
             value_type* ptr = m_data;
             int sz = m_size;
             m_data = nullptr;
@@ -151,6 +249,20 @@ namespace phaseshift {
             m_size_max = 0;
             return {ptr, sz};
         }
+        // Turn this vector into a non-owning view over an external contiguous
+        // buffer: no allocation, no copy, and the destructor leaves the memory
+        // alone. The caller guarantees `data` outlives the view.
+        // External buffers carry no SIMD tail slack and no alignment
+        // guarantee (see resize_allocation): the element-wise operators
+        // detect a view on either side and run their exact-length kernels,
+        // and data() stops claiming the allocation alignment.
+        inline void view_external(value_type* data, int size) {
+            destroy();
+            m_data = data;
+            m_size = size;
+            m_size_max = size;
+            m_owns = false;
+        }
         inline bool is_valid() const {
             return m_data != nullptr;
         }
@@ -163,6 +275,16 @@ namespace phaseshift {
         }
 
         value_type* data() const {
+            // An owned allocation carries PHASESHIFT_SIMD_ALIGNMENT: pass
+            // that on (same as lookup_table::values()) so loops over data()
+            // can emit aligned vector loads without a peel prologue. A
+            // borrowed view (view_external) makes no such promise — NumPy
+            // buffers are commonly 16-byte aligned — and a false alignment
+            // assumption is UB, so it returns the raw pointer.
+            #if defined(__GNUC__) && (PHASESHIFT_SIMD_ALIGNMENT > 1)
+                if (m_owns)
+                    return static_cast<value_type*>(__builtin_assume_aligned(m_data, PHASESHIFT_SIMD_ALIGNMENT));
+            #endif
             return m_data;
         }
 
@@ -177,19 +299,19 @@ namespace phaseshift {
         iterator begin() {return m_data;}
         iterator end() {return m_data+m_size;}
 
-        value_type operator[](int n) const {
+        PHASESHIFT_HOT value_type operator[](int n) const {
             assert(n < m_size);
             return m_data[n];
         }
-        value_type& operator[](int n) {
+        PHASESHIFT_HOT value_type& operator[](int n) {
             assert(n < m_size);
             return m_data[n];
         }
-        value_type operator[](size_t n) const {
+        PHASESHIFT_HOT value_type operator[](size_t n) const {
             assert(static_cast<int>(n) < m_size);
             return m_data[n];
         }
-        value_type& operator[](size_t n) {
+        PHASESHIFT_HOT value_type& operator[](size_t n) {
             assert(static_cast<int>(n) < m_size);
             return m_data[n];
         }
@@ -197,13 +319,12 @@ namespace phaseshift {
         inline void resize(int size) {
             assert(size <= m_size_max);
 
-            if (size == m_size)
-                return;
-
+            // Unconditional: re-assigning an equal int is cheaper than the
+            // size==m_size branch this used to carry in per-sample loops.
             m_size = size;
         }
 
-        inline void push_back(const value_type v) {
+        PHASESHIFT_HOT inline void push_back(const value_type v) {
             assert(m_size+1 <= m_size_max);
 
             m_data[m_size] = v;
@@ -222,6 +343,22 @@ namespace phaseshift {
             push_back(array.data(), array.size());
         }
 
+        //! True when no element is NaN or Inf: batch exponent-bit scan with
+        //! a single final branch (see simd::is_finite), instead of two
+        //! classification calls per element.
+        inline bool is_finite() const {
+            if constexpr (std::is_same_v<value_type, float>) {
+                return phaseshift::simd::is_finite(m_data, m_size);
+            } else if constexpr (std::is_same_v<value_type, std::complex<float>>) {
+                return phaseshift::simd::is_finite(reinterpret_cast<const float*>(m_data), 2*m_size);
+            } else {
+                for (int n = 0; n < m_size; ++n)
+                    if (std::isnan(m_data[n]) || std::isinf(m_data[n]))
+                        return false;
+                return true;
+            }
+        }
+
         inline value_type front() const {
             assert(m_size > 0);
             return m_data[0];
@@ -251,7 +388,23 @@ namespace phaseshift {
 
         inline void operator=(const phaseshift::vector<value_type>& vec) {
             resize(vec.size());
-            memory_copy(m_data, vec.m_data, vec.m_size);
+            if constexpr (std::is_same_v<value_type, float>
+                          && (PHASESHIFT_SIMD_ALIGNMENT >= phaseshift::simd::width_f32*int(sizeof(float)))) {
+                if (m_owns && vec.m_owns) {
+                    // Both bases carry the allocation alignment and both
+                    // carry tail slack: aligned whole-vector moves with no
+                    // memcpy dispatch and no tail loop. push_back(const T*,
+                    // int) cannot take this path, its source pointer is
+                    // arbitrary.
+                    phaseshift::simd::copy_aligned(m_data, vec.m_data, phaseshift::simd::padded_size(m_size));
+                } else {
+                    // A borrowed side (view_external) guarantees neither the
+                    // alignment nor the slack: plain exact-length copy.
+                    memory_copy(m_data, vec.m_data, vec.m_size);
+                }
+            } else {
+                memory_copy(m_data, vec.m_data, vec.m_size);
+            }
         }
         inline void operator=(const phaseshift::ringbuffer<value_type>& rb) {
             resize(rb.size());
@@ -275,85 +428,168 @@ namespace phaseshift {
             }
         }
         inline void operator=(const value_type& value) {
-            value_type* pdata = m_data;
-            for (int n = 0; n < size(); ++n)
-                *pdata++ = value;
+            if constexpr (std::is_same_v<value_type, float>) {
+                // Streaming fill for buffers larger than the LLC
+                phaseshift::simd::fill(m_data, m_size, value);
+            } else {
+                value_type* pdata = m_data;
+                for (int n = 0; n < m_size; ++n)
+                    *pdata++ = value;
+            }
         }
 
+        // Element-wise operators: SIMD kernels when both operands are float,
+        // restrict+ivdep scalar loop otherwise (mixed or complex types).
+        // When every operand owns its allocation, the float kernels get the
+        // size rounded up to the vector width: owned allocations carry tail
+        // slack (see resize_allocation), so the last partial vector is
+        // processed in full instead of lane by lane, and the lanes beyond
+        // size() hold garbage either way. Borrowed views have no slack, so
+        // any view operand drops the padding (see float_kernel_size).
         template<typename T2>
-        inline vector& operator+=(const phaseshift::vector<T2>& arr) {
+        PHASESHIFT_HOT inline vector& operator+=(const phaseshift::vector<T2>& arr) {
             assert(size() == arr.size());
 
-            value_type* pdata = m_data;
-            T2* pdata2 = arr.m_data;
-            for (int n=0; n < m_size; ++n)
-                *pdata++ += *pdata2++;
+            if constexpr (std::is_same_v<value_type, float> && std::is_same_v<T2, float>) {
+                phaseshift::simd::add(m_data, arr.m_data, float_kernel_size(m_owns && arr.m_owns));
+            } else {
+                value_type* PHASESHIFT_RESTRICT pdata = m_data;
+                const T2* PHASESHIFT_RESTRICT pdata2 = arr.m_data;
+                PHASESHIFT_IVDEP
+                for (int n=0; n < m_size; ++n)
+                    *pdata++ += *pdata2++;
+            }
 
             return *this;
         }
         template<typename T2>
-        inline vector& operator-=(const phaseshift::vector<T2>& arr) {
+        PHASESHIFT_HOT inline vector& operator-=(const phaseshift::vector<T2>& arr) {
             assert(size() == arr.size());
 
-            value_type* pdata = m_data;
-            T2* pdata2 = arr.m_data;
-            for (int n=0; n < m_size; ++n)
-                *pdata++ -= *pdata2++;
+            if constexpr (std::is_same_v<value_type, float> && std::is_same_v<T2, float>) {
+                phaseshift::simd::sub(m_data, arr.m_data, float_kernel_size(m_owns && arr.m_owns));
+            } else {
+                value_type* PHASESHIFT_RESTRICT pdata = m_data;
+                const T2* PHASESHIFT_RESTRICT pdata2 = arr.m_data;
+                PHASESHIFT_IVDEP
+                for (int n=0; n < m_size; ++n)
+                    *pdata++ -= *pdata2++;
+            }
 
             return *this;
         }
         template<typename T2>
-        inline vector& operator*=(const phaseshift::vector<T2>& arr) {
+        PHASESHIFT_HOT inline vector& operator*=(const phaseshift::vector<T2>& arr) {
             assert(size() == arr.size());
 
-            value_type* pdata = m_data;
-            T2* pdata2 = arr.m_data;
-            for (int n=0; n < m_size; ++n)
-                *pdata++ *= *pdata2++;
+            if constexpr (std::is_same_v<value_type, float> && std::is_same_v<T2, float>) {
+                phaseshift::simd::mul(m_data, arr.m_data, float_kernel_size(m_owns && arr.m_owns));
+            } else if constexpr (std::is_same_v<value_type, std::complex<float>> && std::is_same_v<T2, std::complex<float>>) {
+                // Spelled out on the underlying float pairs: the compiler
+                // will not vectorize through the std::complex operators, but
+                // emits shuffle-based SIMD for the explicit formula (which is
+                // exactly what libstdc++'s complex multiply computes).
+                float* PHASESHIFT_RESTRICT pd = reinterpret_cast<float*>(m_data);
+                const float* PHASESHIFT_RESTRICT ps = reinterpret_cast<const float*>(arr.m_data);
+                PHASESHIFT_IVDEP
+                for (int n=0; n < m_size; ++n) {
+                    const float ar = pd[2*n],  ai = pd[2*n+1];
+                    const float br = ps[2*n],  bi = ps[2*n+1];
+                    pd[2*n]   = ar*br - ai*bi;
+                    pd[2*n+1] = ar*bi + ai*br;
+                }
+            } else {
+                value_type* PHASESHIFT_RESTRICT pdata = m_data;
+                const T2* PHASESHIFT_RESTRICT pdata2 = arr.m_data;
+                PHASESHIFT_IVDEP
+                for (int n=0; n < m_size; ++n)
+                    *pdata++ *= *pdata2++;
+            }
 
             return *this;
         }
         template<typename T2>
-        inline vector& operator/=(const phaseshift::vector<T2>& arr) {
+        PHASESHIFT_HOT inline vector& operator/=(const phaseshift::vector<T2>& arr) {
             assert(size() == arr.size());
 
-            value_type* pdata = m_data;
-            T2* pdata2 = arr.m_data;
-            for (int n=0; n < m_size; ++n)
-                *pdata++ /= *pdata2++;
+            if constexpr (std::is_same_v<value_type, float> && std::is_same_v<T2, float>) {
+                phaseshift::simd::div(m_data, arr.m_data, float_kernel_size(m_owns && arr.m_owns));
+            } else {
+                value_type* PHASESHIFT_RESTRICT pdata = m_data;
+                const T2* PHASESHIFT_RESTRICT pdata2 = arr.m_data;
+                PHASESHIFT_IVDEP
+                for (int n=0; n < m_size; ++n)
+                    *pdata++ /= *pdata2++;
+            }
 
             return *this;
         }
 
-        inline vector& operator+=(value_type v) {
+        //! Fused (*this) = (*this)*a + b, one pass over the destination where
+        //! the chained operators *= then += would sweep it twice. Same
+        //! contract as ringbuffer::fma.
+        template<typename T2>
+        PHASESHIFT_HOT inline vector& fma(const phaseshift::vector<T2>& a, const phaseshift::vector<T2>& b) {
+            assert(size() == a.size());
+            assert(size() == b.size());
 
-            value_type* pdata = m_data;
-            for (int n=0; n < m_size; ++n)
-                *pdata++ += v;
+            if constexpr (std::is_same_v<value_type, float> && std::is_same_v<T2, float>) {
+                phaseshift::simd::fma(m_data, a.m_data, b.m_data, float_kernel_size(m_owns && a.m_owns && b.m_owns));
+            } else {
+                value_type* PHASESHIFT_RESTRICT pdata = m_data;
+                const T2* PHASESHIFT_RESTRICT pa = a.m_data;
+                const T2* PHASESHIFT_RESTRICT pb = b.m_data;
+                PHASESHIFT_IVDEP
+                for (int n=0; n < m_size; ++n, ++pdata)
+                    *pdata = *pdata * *pa++ + *pb++;
+            }
 
             return *this;
         }
-        inline vector& operator-=(value_type v) {
 
-            value_type* pdata = m_data;
-            for (int n=0; n < m_size; ++n)
-                *pdata++ -= v;
+        PHASESHIFT_HOT inline vector& operator+=(value_type v) {
+            if constexpr (std::is_same_v<value_type, float>) {
+                phaseshift::simd::add(m_data, float_kernel_size(m_owns), v);
+            } else {
+                value_type* pdata = m_data;
+                for (int n=0; n < m_size; ++n)
+                    *pdata++ += v;
+            }
 
             return *this;
         }
-        inline vector& operator*=(value_type v) {
-
-            value_type* pdata = m_data;
-            for (int n=0; n < m_size; ++n)
-                *pdata++ *= v;
+        PHASESHIFT_HOT inline vector& operator-=(value_type v) {
+            if constexpr (std::is_same_v<value_type, float>) {
+                phaseshift::simd::sub(m_data, float_kernel_size(m_owns), v);
+            } else {
+                value_type* pdata = m_data;
+                for (int n=0; n < m_size; ++n)
+                    *pdata++ -= v;
+            }
 
             return *this;
         }
-        inline vector& operator/=(value_type v) {
+        PHASESHIFT_HOT inline vector& operator*=(value_type v) {
+            if constexpr (std::is_same_v<value_type, float>) {
+                phaseshift::simd::mul(m_data, float_kernel_size(m_owns), v);
+            } else {
+                value_type* pdata = m_data;
+                for (int n=0; n < m_size; ++n)
+                    *pdata++ *= v;
+            }
 
-            value_type* pdata = m_data;
-            for (int n=0; n < m_size; ++n)
-                *pdata++ /= v;
+            return *this;
+        }
+        PHASESHIFT_HOT inline vector& operator/=(value_type v) {
+            if constexpr (std::is_same_v<value_type, float>) {
+                // Multiply by the reciprocal computed once, as the
+                // ringbuffer scalar divide does (<1 ulp difference).
+                phaseshift::simd::mul(m_data, float_kernel_size(m_owns), 1.0f/v);
+            } else {
+                value_type* pdata = m_data;
+                for (int n=0; n < m_size; ++n)
+                    *pdata++ /= v;
+            }
 
             return *this;
         }
@@ -373,6 +609,17 @@ namespace phaseshift {
             phaseshift::dev::binaryfile_write_generic_float32(filepath, array, mode);
         }
 
+        //! Overload of the generic per-element sweep in phaseshift/utils.h:
+        //! the storage is contiguous, so the scan is batched.
+        template<typename value_type>
+        inline void signals_check_nan_inf(const phaseshift::vector<value_type>& array) {
+            #ifndef NDEBUG
+            assert(array.is_finite());
+            #else
+            (void)array;
+            #endif
+        }
+
     } // namespace dev
 
 }  // namespace phaseshift
@@ -12,19 +12,18 @@
 #include "stdio.h"
 #include "string.h"
 
+#if !defined(_WIN32) && !defined(_WIN64)
+    #include <sys/resource.h>
+#endif
+#if !defined(_WIN32) && !defined(_WIN64) && !defined(__MACH__) && !defined(__APPLE__)
+    #include <fcntl.h>
+    #include <unistd.h>
+#endif
+
 
 namespace phaseshift {
 namespace dev {
 
-inline int mem_usage_parse_line(char* line){
-    // This assumes that a digit will be found and the line ends in " Kb".
-    int i = strlen(line);
-    const char* p = line;
-    while (*p <'0' || *p > '9') p++;
-    line[i-3] = '\0';
-    i = atoi(p);
-    return i;
-}
 // https://stackoverflow.com/questions/63166/how-to-determine-cpu-and-memory-consumption-from-inside-a-process
 //! [kB]
 inline int mem_usage() { //Note: this value is in KB!
@@ -33,18 +32,43 @@ inline int mem_usage() { //Note: this value is in KB!
     #elif defined(__MACH__) || defined(__APPLE__)
         return -1;
     #else  // Linux
-        FILE* file = fopen("/proc/self/status", "r");
-        int result = -1;
-        char line[128];
-
-        while (fgets(line, 128, file) != NULL){
-            if (strncmp(line, "VmSize:", 7) == 0){
-                result = mem_usage_parse_line(line);
-                break;
-            }
-        }
-        fclose(file);
-        return result;
+        // /proc/self/status is tiny (<4 kB): slurp it with a single read()
+        // and scan for the field, instead of one stdio call per line. This
+        // gets polled from test loops, so the syscall count matters.
+        int fd = open("/proc/self/status", O_RDONLY);
+        if (fd < 0)
+            return -1;
+        char buf[4096];
+        ssize_t nread = read(fd, buf, sizeof(buf)-1);
+        close(fd);
+        if (nread <= 0)
+            return -1;
+        buf[nread] = '\0';
+
+        const char* p = strstr(buf, "VmSize:");
+        if (p == NULL)
+            return -1;
+        // atoi skips the leading whitespace and stops at the " kB" suffix.
+        return atoi(p+7);
+    #endif
+}
+
+//! Peak resident set size [kB]. A single getrusage syscall, no procfs
+//! parsing: cheap enough to sample from tight assertion loops. Note the
+//! metric differs from mem_usage(): peak resident memory, monotonically
+//! increasing, vs the current virtual size.
+inline int mem_usage_peak() {
+    #if defined(_WIN32) || defined(_WIN64)
+        return -1;
+    #else
+        struct rusage ru;
+        if (getrusage(RUSAGE_SELF, &ru) != 0)
+            return -1;
+        #if defined(__MACH__) || defined(__APPLE__)
+            return (int)(ru.ru_maxrss / 1024);  // bytes on macOS
+        #else
+            return (int)ru.ru_maxrss;  // kB on Linux
+        #endif
     #endif
 }
 
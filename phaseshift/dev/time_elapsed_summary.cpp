@@ -10,54 +10,68 @@
 #ifdef PHASESHIFT_DEV_PROFILING
 
 #include <iomanip>
+#include <sstream>
+#include <vector>
 
 void phaseshift::dev::time_elapsed_summary::print(std::ostream& out) const {
-    out << "INFO: Audio blocks usages:" << std::endl;
+    // The report is assembled in one buffer and handed to the stream in a
+    // single write at the end: no per-line flush (std::endl) and no
+    // interleaving with other writers on stderr.
+    std::ostringstream oss;
+    oss << "INFO: Audio blocks usages:" << '\n';
 
-    out << "    Initialize: " << initialize.stats(3) << std::endl;
+    oss << "    Initialize: " << initialize.stats(3) << '\n';
 
     if (m_loop_tes.size() > 0) {
-        out << "    Loop:" << std::endl;
+        oss << "    Loop:" << '\n';
 
-        for (const auto& pair : m_loop_tes)
-            out << "    " << std::setw(28) << pair.first << ": " << pair.second->stats(6) << std::endl;
+        // Single sweep over the time_elapsed objects: the per-entry sums are
+        // cached so the percentage loop below reuses them instead of calling
+        // sum() on each entry a second time.
+        std::vector<double> sums;
+        sums.reserve(m_loop_tes.size());
+        double summed_duration = 0.0;
+        bool max_reached = false;
+        for (const auto& pair : m_loop_tes) {
+            oss << "    " << std::setw(28) << pair.first << ": " << pair.second->stats(6) << '\n';
+
+            const double sum = pair.second->sum();
+            sums.push_back(sum);
+            summed_duration += sum;
+            if (pair.second->size() == pair.second->size_max()) {
+                max_reached = true;
+            }
+        }
 
         // Compute untracked time (assuming all added blocks by loop_add cover the Loop)
         {
-            // The overall time taken to execute the full loop.
+            // The overall time taken to execute the full loop, ideally as
+            // close as possible to `summed_duration`.
             double full_duration = loop.sum();
 
-            // The sum of the time taken by each element running inside the loop.
-            // Thus, ideally as close as possible to `full_duration`.
-            double summed_duration = 0.0;
-            bool max_reached = false;
-            for (const auto& pair : m_loop_tes) {
-                summed_duration += pair.second->sum();
-                if (pair.second->size() == pair.second->size_max()) {
-                    max_reached = true;
-                }
-            }
-
             if (full_duration >= summed_duration) {
                 double duration_untracked = full_duration - summed_duration;
-                out << "        Assuming all of the blocks listed above are in series (none being embedded in any other):" << std::endl;
+                oss << "        Assuming all of the blocks listed above are in series (none being embedded in any other):" << '\n';
 
-                for (const auto& pair : m_loop_tes)
-                    out << "    " << std::setw(28) << pair.first << ": " << acbench::to_string(100*pair.second->sum()/summed_duration, "%4.1f") << "%" << std::endl;
+                for (size_t i = 0; i < m_loop_tes.size(); ++i)
+                    oss << "    " << std::setw(28) << m_loop_tes[i].first << ": " << acbench::to_string(100*sums[i]/summed_duration, "%4.1f") << "%" << '\n';
 
                 if (max_reached) {
-                    out << "    (maximum capacity of some of the element above has been reached, measure of the untracked time cannot be estimated)" << std::endl;
+                    oss << "    (maximum capacity of some of the element above has been reached, measure of the untracked time cannot be estimated)" << '\n';
                 } else {
-                    out << "    \033[3m" << std::setw(28) << "untracked" << "\033[23m: " << acbench::to_string(100*duration_untracked/full_duration, "%4.1f") << "%" << std::endl;
+                    oss << "    \033[3m" << std::setw(28) << "untracked" << "\033[23m: " << acbench::to_string(100*duration_untracked/full_duration, "%4.1f") << "%" << '\n';
                 }
             }
         }
 
     } else {
-        out << "    Loop:       " << loop.stats(3) << std::endl;
+        oss << "    Loop:       " << loop.stats(3) << '\n';
     }
 
-    out << "    Finalize:   " << finalize.stats(3) << std::endl;
+    oss << "    Finalize:   " << finalize.stats(3) << '\n';
+
+    const std::string report = oss.str();
+    out.write(report.data(), static_cast<std::streamsize>(report.size()));
 }
 
 #endif
@@ -12,8 +12,12 @@
 
 #include <acbench/time_elapsed.h>
 
-#include <map>
+#include <algorithm>
+#include <iostream>
 #include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
 
 namespace phaseshift {
     namespace dev {
@@ -35,15 +39,29 @@ namespace phaseshift {
         class time_elapsed_summary {
 
             // The time_elapsed objects segmenting the looped process.
-            std::map<std::string,const acbench::time_elapsed*> m_loop_tes;
+            // A flat sorted vector rather than a std::map: entries are added
+            // once at setup and then only iterated in print(), so contiguous
+            // storage beats a node-per-entry tree there.
+            std::vector<std::pair<std::string, const acbench::time_elapsed*>> m_loop_tes;
 
           public:
             time_elapsed_summary() {
             }
 
             //! The sum of the elements added in here should cover the full loop
-            inline void loop_add(const std::string name, const acbench::time_elapsed* te) {
-                m_loop_tes[name] = te;
+            //! The name is taken as a string_view: callers pass literals, so
+            //! no std::string is built unless the entry is actually inserted.
+            inline void loop_add(std::string_view name, const acbench::time_elapsed* te) {
+                // Sorted insert, preserving the alphabetical print order the
+                // map used to provide.
+                auto it = std::lower_bound(m_loop_tes.begin(), m_loop_tes.end(), name,
+                    [](const std::pair<std::string, const acbench::time_elapsed*>& pair, std::string_view key) {
+                        return pair.first < key;
+                    });
+                if ((it != m_loop_tes.end()) && (it->first == name))
+                    it->second = te;
+                else
+                    m_loop_tes.emplace(it, std::string(name), te);
             }
 
             acbench::time_elapsed initialize;   // The time measure of the whole initialisation.
@@ -11,7 +11,8 @@ phaseshift::lookup_table::lookup_table() {
 }
 
 phaseshift::lookup_table::~lookup_table() {
-    delete[] m_values;
+    if (m_owns_values)
+        phaseshift::allocation::aligned_free(m_values);
     m_values = nullptr;
 }
 
@@ -26,9 +27,8 @@ phaseshift::lookup_table_db2lin01::lookup_table_db2lin01() {
 }
 
 phaseshift::lookup_table_cos::lookup_table_cos() {
-    phaseshift::lookup_table::initialize(this, 0.0f, static_cast<float>(phaseshift::twopi), 1000);  // was 50
+    // Power-of-two size: the index wraps by a bit-mask instead of a float
+    // range reduction (see initialize_periodic).
+    phaseshift::lookup_table::initialize_periodic(this, static_cast<float>(phaseshift::twopi), 1024);
 }
 
-phaseshift::lookup_table_sin::lookup_table_sin() {
-    phaseshift::lookup_table::initialize(this, 0.0f, static_cast<float>(phaseshift::twopi), 1000);  // was 50
-}
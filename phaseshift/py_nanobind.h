@@ -9,10 +9,14 @@
 #define PHASESHIFT_PY_NANOBIND_H_
 
 #include <cstddef>
+#include <cstdint>
 #include <cstring>
-#include <map>
 #include <algorithm>
 #include <limits>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
 
 #include <nanobind/nanobind.h>
 #include <nanobind/stl/vector.h>
@@ -26,8 +30,20 @@ namespace nb = nanobind;
 // Note: ndarray to something should use intermediate convertions to const types (see ndarray2ringbuffer())
 // Note: something to ndarray should use intermediate convertions to non-const types (see ringbuffer2ndarray())
 
+// Single-integer dtype tag so the converters below dispatch with one
+// switch instead of a chain of code/bits compare pairs.
+constexpr uint32_t dtype_tag(nb::dlpack::dtype_code code, uint32_t bits) {
+    return (static_cast<uint32_t>(code) << 16) | bits;
+}
+inline uint32_t dtype_tag(const nb::ndarray<>& a) {
+    return dtype_tag(static_cast<nb::dlpack::dtype_code>(a.dtype().code), a.dtype().bits);
+}
+
 inline void ndarray2ringbuffer(const nb::ndarray<>& _in, phaseshift::ringbuffer<float>* in) {
-    // TODO(GD) Remove extra copy by providing the buffer to the phaseshift::ringbuffer ctor
+    // Note: the ring accumulates pushed audio across calls and its storage
+    // is owned by the acbench::ringbuffer base, so the NumPy buffer cannot
+    // be adopted here the way ndarray2vector_view does: the copy (at most
+    // two memcpy on the contiguous path) is the ingestion itself.
     const int in_size = static_cast<int>(_in.size());
     in->resize_allocation(in_size);
     
@@ -61,7 +77,8 @@ inline void ndarray2ringbuffer(const nb::ndarray<>& _in, phaseshift::ringbuffer<
         }
     }
     
-    if (_in.dtype().code == (uint8_t)nb::dlpack::dtype_code::Float && _in.dtype().bits == 32) {
+    switch (dtype_tag(_in)) {
+    case dtype_tag(nb::dlpack::dtype_code::Float, 32):
         if (is_c_contiguous) {
             // Fast path: contiguous array, can use memcpy
             in->push_back(static_cast<const float*>(_in.data()), in_size);
@@ -74,7 +91,8 @@ inline void ndarray2ringbuffer(const nb::ndarray<>& _in, phaseshift::ringbuffer<
                 in->push_back(data[k * stride_elements]);
             }
         }
-    } else if (_in.dtype().code == (uint8_t)nb::dlpack::dtype_code::Float && _in.dtype().bits == 64) {
+        break;
+    case dtype_tag(nb::dlpack::dtype_code::Float, 64):
         if (is_c_contiguous) {
             in->push_back(static_cast<const double*>(_in.data()), in_size);
         } else {
@@ -85,7 +103,8 @@ inline void ndarray2ringbuffer(const nb::ndarray<>& _in, phaseshift::ringbuffer<
                 in->push_back(data[k * stride_elements]);
             }
         }
-    } else {
+        break;
+    default:
         assert(_in.dtype().code == (uint8_t)nb::dlpack::dtype_code::Float  && "Only float32 or float64 types supported.");
         assert(((_in.dtype().bits == 32) || (_in.dtype().bits == 64)) && "Only float32 or float64 types supported.");
         throw std::runtime_error("Only float32 or float64 types supported.");  // TCE_ALLOW throw TCE_ALLOW_ANY_STRING
@@ -96,32 +115,51 @@ inline nb::ndarray<nb::numpy, float> ringbuffer2ndarray(const phaseshift::ringbu
     if (rb.size() == 0) {
         return nb::ndarray<nb::numpy, float>(nullptr, { 0 });
     }
-    float* data = new float[rb.size()];
+    // Cache-line aligned like the library's own buffers (new float[] only
+    // guarantees 16 bytes): downstream SIMD consumers of the NumPy array
+    // then load without split cache lines.
+    float* data = static_cast<float*>(
+        phaseshift::allocation::aligned_malloc(sizeof(float)*rb.size(), PHASESHIFT_SIMD_ALIGNMENT));
     rb.copy_to_contiguous(data);
-    nb::capsule owner(data, [](void* p) noexcept { delete[] (float*)p; });
+    nb::capsule owner(data, [](void* p) noexcept { phaseshift::allocation::aligned_free(p); });
     return nb::ndarray<nb::numpy, float>(data, { static_cast<size_t>(rb.size()) }, owner);
 }
 
+// Zero-copy version: transfers ownership of the ringbuffer's storage to
+// numpy, rotating it in place first if the content wraps (no copy either way).
+// WARNING: The ringbuffer is left empty, without allocation, after this call.
+inline nb::ndarray<nb::numpy, float> ringbuffer2ndarray_zerocopy(phaseshift::ringbuffer<float>* prb) {
+    auto [data, size] = prb->release_contiguous_allocation();
+    if (data == nullptr) {
+        return nb::ndarray<nb::numpy, float>(nullptr, { 0 });
+    }
+    // Custom deleter for aligned memory allocated by phaseshift::ringbuffer
+    nb::capsule owner(data, [](void* p) noexcept {
+        phaseshift::allocation::aligned_free(p);
+    });
+    return nb::ndarray<nb::numpy, float>(data, { static_cast<size_t>(size) }, owner);
+}
+
 inline void ndarray2vector(const nb::ndarray<>& _in, phaseshift::vector<std::complex<float>>* in) {
-    // TODO(GD) Remove extra copy by providing the buffer to the phaseshift::vector ctor
     const int in_size = static_cast<int>(_in.size());
     in->resize_allocation(in_size);
     in->clear();
-    if (_in.dtype().code == (uint8_t)nb::dlpack::dtype_code::Complex && _in.dtype().bits == 64) {
-        // TODO(GD) SPEEDUP We can use memcpy
-        for (int k=0; k < in_size; ++k) {
-            float real = ((float*)(_in.data()))[2*k];
-            float imag = ((float*)(_in.data()))[2*k+1];
-            std::complex<float> c(real, imag);
-            in->push_back(c);
-        }
-    } else if (_in.dtype().code == (uint8_t)nb::dlpack::dtype_code::Complex && _in.dtype().bits == 128) {
-        for (int k=0; k < in_size; ++k) {
-            float real = static_cast<float>(((double*)(_in.data()))[2*k]);
-            float imag = static_cast<float>(((double*)(_in.data()))[2*k+1]);
-            in->push_back(std::complex<float>(real, imag));
-        }
-    } else {
+    switch (dtype_tag(_in)) {
+    case dtype_tag(nb::dlpack::dtype_code::Complex, 64):
+        // std::complex<float> has the same layout as the interleaved float
+        // pairs of complex64: one bulk copy instead of a per-element
+        // push_back with its size check.
+        in->resize(in_size);
+        std::memcpy(in->data(), _in.data(), in_size*sizeof(std::complex<float>));
+        break;
+    case dtype_tag(nb::dlpack::dtype_code::Complex, 128):
+        // Same layout argument for complex128: narrow the interleaved
+        // doubles as one contiguous 2*n stream (SIMD, see simd::cvt).
+        in->resize(in_size);
+        phaseshift::simd::cvt(reinterpret_cast<float*>(in->data()),
+                              static_cast<const double*>(_in.data()), 2*in_size);
+        break;
+    default:
         assert(_in.dtype().code == (uint8_t)nb::dlpack::dtype_code::Complex  && "Only complex64 and complex128 types supported.");
         assert(((_in.dtype().bits == 64) || (_in.dtype().bits == 128)) && "Only complex64 and complex128 types supported.");
         throw std::runtime_error("Only complex64 and complex128 types supported.");  // TCE_ALLOW throw TCE_ALLOW_ANY_STRING
@@ -129,32 +167,60 @@ inline void ndarray2vector(const nb::ndarray<>& _in, phaseshift::vector<std::com
 }
 
 inline void ndarray2vector(const nb::ndarray<>& _in, phaseshift::vector<float>* in) {
-    // TODO(GD) SPEEDUP Remove extra copy by providing the buffer to the phaseshift::vector ctor
     const int in_size = static_cast<int>(_in.size());
     in->resize_allocation(in_size);
     in->clear();
-    if (_in.dtype().code == (uint8_t)nb::dlpack::dtype_code::Float && _in.dtype().bits == 32) {
+    switch (dtype_tag(_in)) {
+    case dtype_tag(nb::dlpack::dtype_code::Float, 32):
         in->push_back(static_cast<const float*>(_in.data()), in_size);
-    } else if (_in.dtype().code == (uint8_t)nb::dlpack::dtype_code::Float && _in.dtype().bits == 64) {
+        break;
+    case dtype_tag(nb::dlpack::dtype_code::Float, 64):
+        // SIMD narrowing (see simd::cvt) instead of one double-to-float
+        // downcast per element.
         in->resize(in_size);
-        for (int k=0; k < in_size; ++k) {
-            float real = static_cast<float>(((const double*)(_in.data()))[k]);
-            in->data()[k] = real;
-        }
-    } else {
+        phaseshift::simd::cvt(in->data(), static_cast<const double*>(_in.data()), in_size);
+        break;
+    default:
         assert(_in.dtype().code == (uint8_t)nb::dlpack::dtype_code::Float  && "Only float32 or float64 types supported.");
         assert(((_in.dtype().bits == 32) || (_in.dtype().bits == 64)) && "Only float32 or float64 types supported.");
         throw std::runtime_error("Only float32 or float64 or complex64 types supported.");  // TCE_ALLOW throw TCE_ALLOW_ANY_STRING
     }
 }
 
+// Zero-copy versions of ndarray2vector: when the array is 1D, contiguous
+// and already in the target dtype, the vector becomes a view over the NumPy
+// buffer (the DLPack data pointer), skipping the copy entirely. Falls back
+// to the copying converter otherwise, so the vector must be treated as
+// read-only either way.
+// WARNING: The view borrows the NumPy buffer: it is only valid while `_in`
+// is alive (nanobind keeps bound-call arguments alive for the duration of
+// the call), so it must not be retained past it.
+inline void ndarray2vector_view(const nb::ndarray<>& _in, phaseshift::vector<float>* in) {
+    if ((_in.ndim() == 1) && (_in.stride(0) == 1)
+        && (_in.dtype().code == (uint8_t)nb::dlpack::dtype_code::Float) && (_in.dtype().bits == 32)) {
+        in->view_external(const_cast<float*>(static_cast<const float*>(_in.data())), static_cast<int>(_in.size()));
+        return;
+    }
+    ndarray2vector(_in, in);
+}
+inline void ndarray2vector_view(const nb::ndarray<>& _in, phaseshift::vector<std::complex<float>>* in) {
+    if ((_in.ndim() == 1) && (_in.stride(0) == 1)
+        && (_in.dtype().code == (uint8_t)nb::dlpack::dtype_code::Complex) && (_in.dtype().bits == 64)) {
+        in->view_external(const_cast<std::complex<float>*>(static_cast<const std::complex<float>*>(_in.data())), static_cast<int>(_in.size()));
+        return;
+    }
+    ndarray2vector(_in, in);
+}
+
 inline nb::ndarray<nb::numpy, float> vector2ndarray(const phaseshift::vector<float>& vec) {
     if (vec.size() == 0) {
         return nb::ndarray<nb::numpy, float>(nullptr, { 0 });
     }
-    float* data = new float[vec.size()];
+    // Same aligned allocation as ringbuffer2ndarray, for the same reason.
+    float* data = static_cast<float*>(
+        phaseshift::allocation::aligned_malloc(sizeof(float)*vec.size(), PHASESHIFT_SIMD_ALIGNMENT));
     std::memcpy(data, vec.data(), sizeof(float) * vec.size());
-    nb::capsule owner(data, [](void* p) noexcept { delete[] (float*)p; });
+    nb::capsule owner(data, [](void* p) noexcept { phaseshift::allocation::aligned_free(p); });
     return nb::ndarray<nb::numpy, float>(data, { static_cast<size_t>(vec.size()) }, owner);
 }
 
@@ -173,9 +239,64 @@ inline nb::ndarray<nb::numpy, float> vector2ndarray_zerocopy(phaseshift::vector<
     return nb::ndarray<nb::numpy, float>(data, { static_cast<size_t>(size) }, owner);
 }
 
+// Complex counterpart (std::complex<float> maps to complex64): spectra go
+// out without the new+memcpy re-boxing the copying export would pay.
+// WARNING: The vector is left empty after this call.
+inline nb::ndarray<nb::numpy, std::complex<float>> vector2ndarray_zerocopy(phaseshift::vector<std::complex<float>>* pvec) {
+    auto [data, size] = pvec->release_allocation();
+    if (data == nullptr) {
+        return nb::ndarray<nb::numpy, std::complex<float>>(nullptr, { 0 });
+    }
+    nb::capsule owner(data, [](void* p) noexcept {
+        phaseshift::allocation::aligned_free(p);
+    });
+    return nb::ndarray<nb::numpy, std::complex<float>>(data, { static_cast<size_t>(size) }, owner);
+}
+
+
+namespace phaseshift {
+    // Key->value options kept as a sorted flat vector: kwargs counts are
+    // small (<16), so binary search over contiguous pairs beats a node-based
+    // std::map, whose per-insert rebalancing and allocations dominated
+    // kwargs parsing (same idiom as dev::time_elapsed_summary).
+    struct flat_options {
+        std::vector<std::pair<std::string, std::string>> items;
+
+        typedef std::vector<std::pair<std::string, std::string>>::const_iterator const_iterator;
+        inline const_iterator begin() const {return items.begin();}
+        inline const_iterator end() const {return items.end();}
+        inline size_t size() const {return items.size();}
+        inline bool empty() const {return items.empty();}
+
+        inline const_iterator find(std::string_view key) const {
+            auto it = std::lower_bound(items.begin(), items.end(), key,
+                [](const std::pair<std::string, std::string>& item, std::string_view k){return item.first < k;});
+            if ((it != items.end()) && (it->first == key))
+                return it;
+            return items.end();
+        }
+        inline bool contains(std::string_view key) const {
+            return find(key) != items.end();
+        }
+        inline const std::string& at(std::string_view key) const {
+            auto it = find(key);
+            assert(it != items.end());
+            return it->second;
+        }
+        inline void insert_or_assign(std::string key, std::string value) {
+            auto it = std::lower_bound(items.begin(), items.end(), key,
+                [](const std::pair<std::string, std::string>& item, const std::string& k){return item.first < k;});
+            if ((it != items.end()) && (it->first == key))
+                it->second = std::move(value);
+            else
+                items.emplace(it, std::move(key), std::move(value));
+        }
+    };
+}
 
-inline std::map<std::string, std::string> kwargs2options(const nb::kwargs& kwargs) {
-    std::map<std::string, std::string> options;
+inline phaseshift::flat_options kwargs2options(const nb::kwargs& kwargs) {
+    phaseshift::flat_options options;
+    options.items.reserve(nb::len(kwargs));
     for (auto kv: kwargs) {
         options.insert_or_assign(nb::str(kv.first).c_str(), nb::str(kv.second).c_str());
     }
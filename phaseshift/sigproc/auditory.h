@@ -20,44 +20,103 @@ namespace phaseshift {
 inline float hz2mel(float freq) {
     constexpr float knee = 1000.0f;
     constexpr float lin = 3.0f / 200.0f;
-    if (freq < knee) {
-        return lin * freq;
-    } else {
-        constexpr float log_coef = 27.0f / 1.8562979903656263f;  // std::log(6.4f)=1.8562979903656263
-        constexpr float start = knee * lin;
-        return start + log_coef * std::log(freq/knee);
-    }
+    constexpr float log_coef = 27.0f / 1.8562979903656263f;  // std::log(6.4f)=1.8562979903656263
+    constexpr float start = knee * lin;
+    // log(freq/knee) = log(freq)-log(knee): folding log(knee) into the
+    // additive constant removes the division from the call.
+    constexpr float log_knee = 6.907755278982137f;  // std::log(1000.0f)
+    constexpr float offset = start - log_coef*log_knee;
+    // Both branches are evaluated and the ternary compiles to a select:
+    // no data-dependent branch, and a batch caller vectorizes to a blend.
+    // The max keeps the always-evaluated log away from zero and negatives.
+    float lin_part = lin * freq;
+    float log_part = offset + log_coef * std::log(std::max(freq, knee));
+    return freq < knee ? lin_part : log_part;
 }
 inline float mel2hz(float mel) {
     constexpr float knee = 1000.0f;
     constexpr float lin_inv = 200.0f / 3.0f;
     constexpr float start = knee / lin_inv;
     constexpr float log_coef_inv = 1.8562979903656263f / 27.0f;  // std::log(6.4f)=1.8562979903656263
+    // knee*exp(y) = exp(y+log(knee)): folding log(knee) into the exponent
+    // removes the trailing multiply.
+    constexpr float log_knee = 6.907755278982137f;  // std::log(1000.0f)
 
-    // If higher than knee, use log scale, otherwise just keep linear scale
-    if (mel > start) {
-        return knee * std::exp((mel - start) * log_coef_inv);
-    } else {
-        return mel * lin_inv;
-    }
+    // Same branchless select as hz2mel; the max pins the always-evaluated
+    // exponent at the knee on the linear side.
+    float lin_part = mel * lin_inv;
+    float log_part = std::exp((std::max(mel, start) - start) * log_coef_inv + log_knee);
+    return mel > start ? log_part : lin_part;
 }
 
 
+// Per-pipeline cache of the mel value of every FFT bin: filterbank
+// construction indexes this instead of paying one log per bin per frame.
+// Build once at configuration time (the space-for-time counterpart of the
+// lookup tables, but exact since the bin grid is known).
+struct mel_bin_table {
+    phaseshift::vector<float> bin_mel;
+
+    //! Fill bin_mel for the n_fft/2+1 positive-frequency bins of an
+    //! n_fft-point transform at sampling rate fs.
+    void build(int n_fft, float fs) {
+        assert(n_fft > 0);
+        const int nbbins = n_fft/2 + 1;
+        bin_mel.resize_allocation(nbbins);
+        bin_mel.resize(nbbins);
+        const float hz_per_bin = fs/n_fft;
+        for (int k = 0; k < nbbins; ++k)
+            bin_mel[k] = hz2mel(k*hz_per_bin);
+    }
+};
+
 // https://en.wikipedia.org/wiki/A-weighting
+//
+// The *_sq variants return the squared magnitude |H(f)|^2: power-spectrum
+// weighting consumes the square directly, so these skip the sqrt entirely
+// and compute the shared f^2 term once. The plain variants keep the
+// amplitude semantics as sqrt of the squared form. The products are
+// ordered ratio-first so the squared numerators stay within float range
+// up to the audio band.
+inline float a_weighting_sq(float f) {
+    const float f2 = f*f;
+    const float f4 = f2*f2;
+    const float r = (12194.0f*12194.0f) * f4 / ( (f2 + 20.6f*20.6f) * (f2 + 12194.0f*12194.0f) );
+    return r*r / ( (f2 + 107.7f*107.7f) * (f2 + 737.9f*737.9f) );
+}
 inline float a_weighting(float f) {
-    return (12194.0f*12194.0f) * (f*f*f*f) / ( (f*f + 20.6f*20.6f) * std::sqrt( (f*f + 107.7f*107.7f) * (f*f + 737.9f*737.9f) ) * (f*f + 12194.0f*12194.0f) );
+    return std::sqrt(a_weighting_sq(f));
+}
+inline float b_weighting_sq(float f) {
+    const float f2 = f*f;
+    const float r = (12194.0f*12194.0f) * f2 / ( (f2 + 20.6f*20.6f) * (f2 + 12194.0f*12194.0f) );
+    return r*r * f2 / (f2 + 158.5f*158.5f);
 }
 inline float b_weighting(float f) {
-    return (12194.0f*12194.0f) * (f*f*f) / ( (f*f + 20.6f*20.6f) * std::sqrt( (f*f + 158.5f*158.5f) ) * (f*f + 12194.0*12194.0f) );
+    return std::sqrt(b_weighting_sq(f));
 }
 inline float c_weighting(float f) {
-    return (12194.0f*12194.0f) * (f*f) / ( (f*f + 20.6f*20.6f) * (f*f + 12194.0f*12194.0f) );
+    const float f2 = f*f;
+    return (12194.0f*12194.0f) * f2 / ( (f2 + 20.6f*20.6f) * (f2 + 12194.0f*12194.0f) );
+}
+inline float c_weighting_sq(float f) {
+    const float w = c_weighting(f);
+    return w*w;
+}
+inline float d_weighting_sq(float f) {
+    const float f2 = f*f;
+    const float v1 = (1037918.48f - f2);
+    const float v2 = (9837328.0f - f2);
+    const float h_f = (v1*v1 + 1080768.16f*f2) / ( v2*v2 + 11723776.0f*f2 );
+    // Normalization is f divided by 6.8966888496476e-5 (which makes the
+    // weighting 1.0 at 1 kHz); the former f/6.8966888496476f*10e-5 put the
+    // exponent on the wrong side of the division and scaled the whole
+    // curve by 1e-9.
+    const float g = f * 14499.712f;  // 1.0f/6.8966888496476e-5f
+    return g*g * h_f / ((f2 + 79919.29f)*(f2 + 1345600.0f));
 }
 inline float d_weighting(float f) {
-    float v1 = (1037918.48f - f*f);
-    float v2 = (9837328.0f - f*f);
-    float h_f = (v1*v1 + 1080768.16f*f*f) / ( v2*v2 + 11723776.0f*f*f );
-    return (f/6.8966888496476f*10e-5) * std::sqrt(h_f / ((f*f + 79919.29f)*(f*f + 1345600.0f)));
+    return std::sqrt(d_weighting_sq(f));
 }
 
 }  // namespace phaseshift
@@ -14,7 +14,7 @@ def c_weighting(f):
 
 def d_weighting(f):
     h_f = ((1037918.48 - f**2)**2 + 1080768.16*f**2) / ( (9837328 - f**2)**2 + 11723776*f**2 )
-    return (f/6.8966888496476*10e-5) * np.sqrt(h_f / ((f**2 + 79919.29)*(f**2 + 1345600)))
+    return (f/6.8966888496476e-5) * np.sqrt(h_f / ((f**2 + 79919.29)*(f**2 + 1345600)))
 
 def lin2db(x):
     return 20.0 * np.log10(x)
@@ -24,6 +24,17 @@ TEST_CASE("auditory_mel_roundtrip", "[auditory]") {
     REQUIRE(phaseshift::hz2mel(1000.0f) < phaseshift::hz2mel(2000.0f));
 }
 
+TEST_CASE("auditory_mel_bin_table", "[auditory]") {
+    phaseshift::mel_bin_table table;
+    table.build(1024, 44100.0f);
+
+    REQUIRE(table.bin_mel.size() == 513);
+    REQUIRE(table.bin_mel[0] == 0.0f);
+    for (int k = 0; k < table.bin_mel.size(); ++k) {
+        REQUIRE(table.bin_mel[k] == phaseshift::hz2mel(k*44100.0f/1024));
+    }
+}
+
 TEST_CASE("auditory_weighting_finite", "[auditory]") {
     float freqs[] = {1000.0f, 10000.0f};
     for (float f : freqs) {
@@ -40,4 +51,7 @@ TEST_CASE("auditory_weighting_finite", "[auditory]") {
         REQUIRE(cw > 0.0f);
         REQUIRE(dw > 0.0f);
     }
+
+    // The D-weighting normalization makes the curve 1.0 at 1 kHz.
+    REQUIRE(std::abs(phaseshift::d_weighting(1000.0f) - 1.0f) < 1e-4f);
 }
@@ -8,6 +8,11 @@
 #include "./clipper.h"
 #include "./clipper_table.h"  // Include only once, here, and no where else.
 
+// The header-side constants must track the generated table: catch a
+// regeneration with different geometry at compile time.
+static_assert(phaseshift::lookup_table_clipper01::k_size == g_clipper_table_size, "clipper table geometry changed: update lookup_table_clipper01::k_size");
+static_assert(phaseshift::lookup_table_clipper01::k_xmax == g_clipper_table_xmax, "clipper table geometry changed: update lookup_table_clipper01::k_xmax");
+
 phaseshift::lookup_table_clipper01::lookup_table_clipper01() {
 
     // Don't use the lookup_table::initialize(.)
@@ -20,6 +25,10 @@ phaseshift::lookup_table_clipper01::lookup_table_clipper01() {
 
     m_x2i = (m_size-1) / (m_xmax - m_xmin);
 
-    m_values = new float[m_size];
-    std::memcpy(m_values, g_clipper_table, m_size*sizeof(float));
+    // The generated table is static, read-only, cache-line aligned and
+    // already padded with its saturated value (see clipper_table.h): point
+    // at it directly instead of duplicating it on the heap, which halves
+    // the resident footprint and lets the compiler fold the base address.
+    m_values = const_cast<float*>(g_clipper_table);
+    m_owns_values = false;
 }
@@ -10,6 +10,7 @@
 
 #include <cstddef>
 #include <cmath>
+#include <algorithm>
 
 #include <phaseshift/lookup_table.h>
 
@@ -26,12 +27,36 @@ namespace phaseshift {
      public:
         lookup_table_clipper01();
 
+        //! Compile-time mirror of the generated table geometry. The base
+        //! members are set from clipper_table.h at construction (and
+        //! clipper.cpp static_asserts these match), but the hot evaluators
+        //! use the constants so the multiplier and clamp bound fold into
+        //! immediates instead of per-call member loads.
+        static constexpr int k_size = 601;
+        static constexpr float k_xmax = 3.0f;
+        static constexpr float k_x2i = (k_size-1) / k_xmax;
+
         template<typename value_type>
         inline value_type evaluate_lookup_table(value_type x) const {
-            float nf = x*m_x2i;  // m_xmin==0.0f => (x-m_xmin)*m_x2i;
-            if (static_cast<int>(nf) >= m_size-1)  return 1.0f;
-            float y = lookup_table::interp_linear_unchecked_boundaries(nf);
-            return y;
+            // Branchless saturation: clamping nf to the last entry (one
+            // minss) makes the interpolation read values[m_size-1] with a
+            // zero fraction, i.e. exactly 1.0 (the neighbour it reads at
+            // m_size is the saturated padding, see clipper_table.h). The
+            // callers guarantee x >= 0.
+            float nf = std::min(x*k_x2i, static_cast<float>(k_size-1));  // m_xmin==0.0f => (x-m_xmin)*m_x2i;
+            return lookup_table::interp_linear_unchecked_boundaries(nf);
+        }
+
+        //! Closed form of the table content: the table samples the cubic
+        //! Hermite spline rising from (0, slope 1) to (xmax, slope 0),
+        //! which is exactly 1-(1-x/xmax)^3. Evaluating it directly
+        //! (PHASESHIFT_CLIPPER_POLY) costs three multiplies and no memory
+        //! traffic, and is exact where the table interpolates.
+        template<typename value_type>
+        inline value_type evaluate_poly(value_type x) const {
+            float u = 1.0f - x*(1.0f/k_xmax);
+            u = std::max(0.0f, u);  // saturates to 1 beyond the transition band
+            return 1.0f - u*u*u;
         }
 
         template<typename value_type>
@@ -43,6 +68,108 @@ namespace phaseshift {
 
     static constexpr float clipper_knee_def = 0.66f;
     static constexpr float clipper_limit_def = 127.0f/128;  // 8-bit signed upper limit (=0.9921875)
+
+    //! Pointer+length core of the clipper, 8 lanes per iteration on AVX2:
+    //! |v| and the sign come from bit masks, the table lookup becomes two
+    //! gathers (entry and entry+1) with the interpolation done lane-wise,
+    //! and the saturated / untouched lanes are blended back in. A whole
+    //! vector below the knee (the common case on audio) is skipped with a
+    //! single mask test.
+    inline void clipper(float* PHASESHIFT_RESTRICT in, int size, float knee=clipper_knee_def, float limit=clipper_limit_def) {
+
+        assert(limit > knee);
+
+        float transition_band = limit - knee;
+        float invtransition_band = 1.0f/transition_band;
+
+        int n = 0;
+        #if defined(PHASESHIFT_SIMD_X86) && defined(__AVX2__)
+        {
+            #ifdef PHASESHIFT_CLIPPER_POLY
+                const __m256 vinvxmax = _mm256_set1_ps(1.0f/lookup_table_clipper01::k_xmax);
+            #else
+                const float* PHASESHIFT_RESTRICT table = g_clipper_lt.values();
+                const __m256 vx2i = _mm256_set1_ps(lookup_table_clipper01::k_x2i);
+                const __m256i izero = _mm256_setzero_si256();
+                const __m256i ione = _mm256_set1_epi32(1);
+                const __m256i idxmax = _mm256_set1_epi32(lookup_table_clipper01::k_size-2);
+            #endif
+            const __m256 absmask = _mm256_castsi256_ps(_mm256_set1_epi32(0x7fffffff));
+            const __m256 signmask = _mm256_castsi256_ps(_mm256_set1_epi32(static_cast<int>(0x80000000u)));
+            const __m256 vknee = _mm256_set1_ps(knee);
+            const __m256 vtb = _mm256_set1_ps(transition_band);
+            const __m256 vinvtb = _mm256_set1_ps(invtransition_band);
+            const __m256 one = _mm256_set1_ps(1.0f);
+            for (; n+8 <= size; n += 8) {
+                __m256 v = _mm256_loadu_ps(in+n);
+                __m256 va = _mm256_and_ps(v, absmask);
+                __m256 active = _mm256_cmp_ps(va, vknee, _CMP_GT_OQ);
+                if (_mm256_testz_ps(active, active))
+                    continue;
+                #ifdef PHASESHIFT_CLIPPER_POLY
+                    // Closed-form cubic, see evaluate_poly: the max also
+                    // handles saturation, and the inactive lanes (u > 1,
+                    // c < 0) are overridden by the blend below.
+                    __m256 xb = _mm256_mul_ps(_mm256_sub_ps(va, vknee), vinvtb);
+                    __m256 u = _mm256_max_ps(_mm256_setzero_ps(), _mm256_sub_ps(one, _mm256_mul_ps(xb, vinvxmax)));
+                    __m256 c = _mm256_sub_ps(one, _mm256_mul_ps(u, _mm256_mul_ps(u, u)));
+                #else
+                    // Same index arithmetic as evaluate_lookup_table: nf =
+                    // (|v|-knee)/transition_band * x2i, truncated. The index is
+                    // clamped to the table so the gathers stay in bounds on the
+                    // inactive (negative nf) and saturated lanes; those lanes
+                    // are overridden by the blends below.
+                    __m256 nf = _mm256_mul_ps(_mm256_mul_ps(_mm256_sub_ps(va, vknee), vinvtb), vx2i);
+                    __m256i idx = _mm256_cvttps_epi32(nf);
+                    __m256i sat = _mm256_cmpgt_epi32(idx, idxmax);
+                    idx = _mm256_max_epi32(izero, _mm256_min_epi32(idx, idxmax));
+                    __m256 g = _mm256_sub_ps(nf, _mm256_cvtepi32_ps(idx));
+                    __m256 prev = _mm256_i32gather_ps(table, idx, 4);
+                    __m256 next = _mm256_i32gather_ps(table, _mm256_add_epi32(idx, ione), 4);
+                    // Same contraction as interp_linear_fma: one fused op
+                    // instead of the mul/add pair when the target has FMA.
+                    #if defined(__FMA__)
+                        __m256 c = _mm256_fmadd_ps(g, _mm256_sub_ps(next, prev), prev);
+                    #else
+                        __m256 c = _mm256_add_ps(prev, _mm256_mul_ps(g, _mm256_sub_ps(next, prev)));
+                    #endif
+                    c = _mm256_blendv_ps(c, one, _mm256_castsi256_ps(sat));
+                #endif
+                #if defined(__FMA__)
+                    __m256 res = _mm256_fmadd_ps(vtb, c, vknee);
+                #else
+                    __m256 res = _mm256_add_ps(vknee, _mm256_mul_ps(vtb, c));
+                #endif
+                res = _mm256_or_ps(res, _mm256_and_ps(v, signmask));
+                _mm256_storeu_ps(in+n, _mm256_blendv_ps(v, res, active));
+            }
+        }
+        #endif
+        for (; n < size; ++n) {
+            float v = in[n];
+
+            // Branchless, like the vector body above: fabs/copysign are
+            // sign-bit masks, the lookup argument is clamped at the knee so
+            // it stays in the table for the untouched samples, and the
+            // compare resolves as a select instead of a data-dependent
+            // branch (near-threshold audio mispredicts one every other
+            // sample).
+            float av = std::fabs(v);
+            #ifdef PHASESHIFT_CLIPPER_POLY
+                float c = g_clipper_lt.evaluate_poly(std::max(0.0f, av-knee)*invtransition_band);
+            #else
+                float c = g_clipper_lt.evaluate_lookup_table(std::max(0.0f, av-knee)*invtransition_band);
+            #endif
+            float clipped = std::copysign(knee + transition_band*c, v);
+            in[n] = av > knee ? clipped : v;
+        }
+    }
+
+    //! Contiguous float vectors go through the pointer+length core above.
+    inline void clipper(phaseshift::vector<float>* in, float knee=clipper_knee_def, float limit=clipper_limit_def) {
+        clipper(in->data(), in->size(), knee, limit);
+    }
+
     template<class array_type>
     void clipper(array_type* in, float knee=clipper_knee_def, float limit=clipper_limit_def) {
 
@@ -54,13 +181,15 @@ namespace phaseshift {
         for (int n=0; n<int(in->size()); ++n) {
             float v = (*in)[n];
 
-            if (v > +knee) {
-                float c = g_clipper_lt.evaluate_lookup_table((v-knee)*invtransition_band);
-                (*in)[n] = knee + transition_band * c;
-            } else if (v < -knee) {
-                float c = g_clipper_lt.evaluate_lookup_table((-v-knee)*invtransition_band);
-                (*in)[n] = -(knee + transition_band * c);
-            }
+            // Same branchless select as the pointer core.
+            float av = std::fabs(v);
+            #ifdef PHASESHIFT_CLIPPER_POLY
+                float c = g_clipper_lt.evaluate_poly(std::max(0.0f, av-knee)*invtransition_band);
+            #else
+                float c = g_clipper_lt.evaluate_lookup_table(std::max(0.0f, av-knee)*invtransition_band);
+            #endif
+            float clipped = std::copysign(knee + transition_band*c, v);
+            (*in)[n] = av > knee ? clipped : v;
         }
     }
 }
@@ -1,6 +1,10 @@
 // Generated by clipper_table_gen.py
-float g_clipper_table_xmin = 0.0f;
-float g_clipper_table_xmax = 3.0f;
-int g_clipper_table_size = 601;
-float g_clipper_table_step = 0.005f;
-const static float g_clipper_table[] = {0.0f, 0.004991671f, 0.009966704f, 0.014925125f, 0.019866964f, 0.024792245f, 0.029701f, 0.034593254f, 0.039469037f, 0.044328377f, 0.049171295f, 0.05399783f, 0.058808f, 0.06360184f, 0.06837937f, 0.07314063f, 0.07788563f, 0.082614414f, 0.087327f, 0.092023425f, 0.0967037f, 0.101367876f, 0.106015965f, 0.110648f, 0.115264f, 0.119864f, 0.12444804f, 0.12901613f, 0.1335683f, 0.13810457f, 0.142625f, 0.1471296f, 0.15161838f, 0.15609138f, 0.16054863f, 0.16499016f, 0.169416f, 0.17382617f, 0.1782207f, 0.18259962f, 0.18696296f, 0.19131075f, 0.195643f, 0.19995975f, 0.20426103f, 0.20854688f, 0.2128173f, 0.21707232f, 0.221312f, 0.22553633f, 0.22974537f, 0.23393913f, 0.23811764f, 0.24228092f, 0.246429f, 0.25056192f, 0.2546797f, 0.2587824f, 0.26286995f, 0.2669425f, 0.271f, 0.2750425f, 0.27907005f, 0.28308263f, 0.2870803f, 0.29106307f, 0.295031f, 0.29898408f, 0.30292237f, 0.30684587f, 0.31075463f, 0.31464866f, 0.318528f, 0.32239267f, 0.32624272f, 0.33007812f, 0.33389896f, 0.33770525f, 0.341497f, 0.34527424f, 0.34903705f, 0.35278538f, 0.35651928f, 0.36023882f, 0.363944f, 0.36763483f, 0.37131137f, 0.37497362f, 0.37862164f, 0.3822554f, 0.385875f, 0.3894804f, 0.3930717f, 0.39664888f, 0.40021196f, 0.403761f, 0.407296f, 0.410817f, 0.41432405f, 0.41781712f, 0.4212963f, 0.4247616f, 0.428213f, 0.43165058f, 0.43507436f, 0.43848437f, 0.44188064f, 0.44526315f, 0.448632f, 0.45198718f, 0.4553287f, 0.45865664f, 0.46197096f, 0.46527174f, 0.468559f, 0.47183275f, 0.47509304f, 0.47833988f, 0.48157328f, 0.48479334f, 0.488f, 0.49119332f, 0.49437338f, 0.49754012f, 0.5006936f, 0.5038339f, 0.506961f, 0.5100749f, 0.5131757f, 0.51626337f, 0.51933795f, 0.5223995f, 0.525448f, 0.5284835f, 0.53150606f, 0.5345156f, 0.5375123f, 0.54049605f, 0.543467f, 0.5464251f, 0.54937035f, 0.5523029f, 0.55522263f, 0.55812967f, 0.561024f, 0.56390566f, 0.5667747f, 0.5696311f, 0.57247496f, 0.57530624f, 0.578125f, 0.58093125f, 0.58372504f, 0.58650637f, 0.5892753f, 0.59203184f, 0.594776f, 0.59750783f, 0.60022736f, 0.6029346f, 0.6056296f, 0.6083124f, 0.610983f, 0.61364144f, 0.6162877f, 0.6189219f, 0.62154394f, 0.624154f, 0.626752f, 0.629338f, 0.63191205f, 0.6344741f, 0.6370243f, 0.6395626f, 0.642089f, 0.6446036f, 0.64710635f, 0.64959735f, 0.6520766f, 0.6545442f, 0.657f, 0.65944415f, 0.6618767f, 0.66429764f, 0.666707f, 0.66910475f, 0.671491f, 0.67386574f, 0.67622906f, 0.6785809f, 0.6809213f, 0.6832503f, 0.685568f, 0.6878743f, 0.6901694f, 0.69245315f, 0.69472563f, 0.6969869f, 0.699237f, 0.7014759f, 0.7037037f, 0.7059204f, 0.70812595f, 0.7103205f, 0.712504f, 0.7146765f, 0.71683806f, 0.7189886f, 0.7211283f, 0.72325706f, 0.725375f, 0.7274821f, 0.7295784f, 0.7316639f, 0.7337386f, 0.73580265f, 0.737856f, 0.7398987f, 0.7419307f, 0.7439521f, 0.745963f, 0.74796325f, 0.749953f, 0.75193226f, 0.75390106f, 0.7558594f, 0.7578073f, 0.7597448f, 0.761672f, 0.76358885f, 0.76549536f, 0.7673916f, 0.76927763f, 0.7711534f, 0.773019f, 0.77487445f, 0.7767197f, 0.77855486f, 0.78037995f, 0.782195f, 0.784f, 0.78579503f, 0.78758f, 0.7893551f, 0.7911203f, 0.7928756f, 0.794621f, 0.79635656f, 0.79808235f, 0.79979837f, 0.8015046f, 0.80320114f, 0.804888f, 0.80656517f, 0.8082327f, 0.8098906f, 0.81153893f, 0.81317776f, 0.814807f, 0.81642675f, 0.81803703f, 0.8196379f, 0.8212293f, 0.8228113f, 0.824384f, 0.82594734f, 0.82750136f, 0.82904613f, 0.8305816f, 0.8321079f, 0.833625f, 0.8351329f, 0.8366317f, 0.83812135f, 0.83960193f, 0.8410735f, 0.842536f, 0.8439895f, 0.845434f, 0.84686965f, 0.8482963f, 0.8497141f, 0.851123f, 0.8525231f, 0.8539144f, 0.85529685f, 0.8566706f, 0.8580357f, 0.859392f, 0.86073965f, 0.8620787f, 0.8634091f, 0.86473095f, 0.8660442f, 0.867349f, 0.86864525f, 0.869933f, 0.87121236f, 0.8724833f, 0.8737458f, 0.875f, 0.87624586f, 0.87748337f, 0.87871265f, 0.87993366f, 0.88114643f, 0.882351f, 0.8835474f, 0.8847357f, 0.8859159f, 0.88708794f, 0.888252f, 0.889408f, 0.890556f, 0.89169604f, 0.8928281f, 0.8939523f, 0.8950686f, 0.896177f, 0.8972776f, 0.8983704f, 0.89945537f, 0.9005326f, 0.90160215f, 0.902664f, 0.9037182f, 0.9047647f, 0.9058036f, 0.90683496f, 0.9078587f, 0.908875f, 0.90988374f, 0.91088504f, 0.9118789f, 0.9128653f, 0.91384435f, 0.914816f, 0.91578037f, 0.9167374f, 0.9176871f, 0.91862965f, 0.9195649f, 0.920493f, 0.9214139f, 0.9223277f, 0.9232344f, 0.92413396f, 0.9250265f, 0.925912f, 0.9267905f, 0.927662f, 0.92852664f, 0.9293843f, 0.9302351f, 0.931079f, 0.9319161f, 0.93274635f, 0.93356985f, 0.9343866f, 0.93519664f, 0.936f, 0.93679667f, 0.9375867f, 0.9383701f, 0.93914694f, 0.93991727f, 0.940681f, 0.94143826f, 0.94218904f, 0.9429334f, 0.9436713f, 0.9444028f, 0.945128f, 0.94584686f, 0.94655937f, 0.9472656f, 0.9479656f, 0.9486594f, 0.949347f, 0.9500284f, 0.9507037f, 0.95137286f, 0.95203596f, 0.952693f, 0.953344f, 0.953989f, 0.95462805f, 0.9552611f, 0.9558883f, 0.9565096f, 0.957125f, 0.9577346f, 0.9583384f, 0.9589364f, 0.9595286f, 0.96011513f, 0.960696f, 0.96127117f, 0.9618407f, 0.9624046f, 0.962963f, 0.96351576f, 0.964063f, 0.96460474f, 0.96514106f, 0.9656719f, 0.9661973f, 0.9667173f, 0.967232f, 0.9677413f, 0.9682454f, 0.9687441f, 0.9692376f, 0.9697259f, 0.970209f, 0.9706869f, 0.9711597f, 0.97162735f, 0.97208995f, 0.9725475f, 0.973f, 0.9734475f, 0.97389007f, 0.9743276f, 0.9747603f, 0.9751881f, 0.975611f, 0.9760291f, 0.9764424f, 0.97685087f, 0.9772546f, 0.9776537f, 0.978048f, 0.97843766f, 0.9788227f, 0.9792031f, 0.979579f, 0.97995025f, 0.980317f, 0.9806793f, 0.981037f, 0.98139036f, 0.9817393f, 0.98208386f, 0.982424f, 0.98275983f, 0.98309135f, 0.98341864f, 0.98374164f, 0.9840604f, 0.984375f, 0.9846854f, 0.9849917f, 0.98529387f, 0.98559195f, 0.985886f, 0.986176f, 0.986462f, 0.98674405f, 0.9870221f, 0.9872963f, 0.9875666f, 0.987833f, 0.9880956f, 0.9883544f, 0.9886094f, 0.9888606f, 0.98910815f, 0.989352f, 0.9895922f, 0.9898287f, 0.99006164f, 0.99029094f, 0.9905167f, 0.990739f, 0.99095774f, 0.991173f, 0.99138486f, 0.9915933f, 0.99179834f, 0.992f, 0.99219835f, 0.9923934f, 0.9925851f, 0.99277365f, 0.9929589f, 0.993141f, 0.9933199f, 0.9934957f, 0.9936684f, 0.99383795f, 0.9940045f, 0.994168f, 0.9943285f, 0.99448603f, 0.99464065f, 0.9947923f, 0.99494106f, 0.995087f, 0.9952301f, 0.9953704f, 0.9955079f, 0.9956426f, 0.9957747f, 0.995904f, 0.9960307f, 0.9961547f, 0.99627614f, 0.996395f, 0.9965112f, 0.996625f, 0.9967362f, 0.99684507f, 0.9969514f, 0.9970553f, 0.99715686f, 0.997256f, 0.99735284f, 0.9974474f, 0.99753964f, 0.99762964f, 0.99771744f, 0.997803f, 0.9978864f, 0.9979677f, 0.9980469f, 0.99812394f, 0.998199f, 0.998272f, 0.998343f, 0.998412f, 0.9984791f, 0.9985443f, 0.9986076f, 0.998669f, 0.9987286f, 0.9987864f, 0.99884236f, 0.99889666f, 0.99894917f, 0.999f, 0.9990492f, 0.9990967f, 0.99914265f, 0.999187f, 0.9992297f, 0.999271f, 0.99931073f, 0.99934906f, 0.9993859f, 0.9994213f, 0.99945533f, 0.999488f, 0.99951935f, 0.9995494f, 0.9995781f, 0.99960566f, 0.99963194f, 0.999657f, 0.99968094f, 0.9997037f, 0.9997254f, 0.99974597f, 0.9997655f, 0.999784f, 0.9998015f, 0.999818f, 0.99983364f, 0.9998483f, 0.9998621f, 0.999875f, 0.9998871f, 0.9998984f, 0.99990886f, 0.99991864f, 0.99992764f, 0.999936f, 0.9999437f, 0.9999507f, 0.99995714f, 0.999963f, 0.99996823f, 0.999973f, 0.99997723f, 0.99998105f, 0.9999844f, 0.9999873f, 0.9999898f, 0.999992f, 0.99999386f, 0.99999535f, 0.9999966f, 0.9999976f, 0.9999984f, 0.999999f, 0.9999994f, 0.9999997f, 0.9999999f, 0.99999994f, 1.0f, 1.0f};
+// The table is read-only and known at compile time: it lives in .rodata
+// (constexpr), cache-line aligned and padded to a multiple of 16 floats
+// with its saturated value, so lookup_table_clipper01 points straight at
+// it instead of duplicating it on the heap.
+constexpr float g_clipper_table_xmin = 0.0f;
+constexpr float g_clipper_table_xmax = 3.0f;
+constexpr int g_clipper_table_size = 601;
+constexpr float g_clipper_table_step = 0.005f;
+alignas(64) constexpr float g_clipper_table[] = {0.0f, 0.004991671f, 0.009966704f, 0.014925125f, 0.019866964f, 0.024792245f, 0.029701f, 0.034593254f, 0.039469037f, 0.044328377f, 0.049171295f, 0.05399783f, 0.058808f, 0.06360184f, 0.06837937f, 0.07314063f, 0.07788563f, 0.082614414f, 0.087327f, 0.092023425f, 0.0967037f, 0.101367876f, 0.106015965f, 0.110648f, 0.115264f, 0.119864f, 0.12444804f, 0.12901613f, 0.1335683f, 0.13810457f, 0.142625f, 0.1471296f, 0.15161838f, 0.15609138f, 0.16054863f, 0.16499016f, 0.169416f, 0.17382617f, 0.1782207f, 0.18259962f, 0.18696296f, 0.19131075f, 0.195643f, 0.19995975f, 0.20426103f, 0.20854688f, 0.2128173f, 0.21707232f, 0.221312f, 0.22553633f, 0.22974537f, 0.23393913f, 0.23811764f, 0.24228092f, 0.246429f, 0.25056192f, 0.2546797f, 0.2587824f, 0.26286995f, 0.2669425f, 0.271f, 0.2750425f, 0.27907005f, 0.28308263f, 0.2870803f, 0.29106307f, 0.295031f, 0.29898408f, 0.30292237f, 0.30684587f, 0.31075463f, 0.31464866f, 0.318528f, 0.32239267f, 0.32624272f, 0.33007812f, 0.33389896f, 0.33770525f, 0.341497f, 0.34527424f, 0.34903705f, 0.35278538f, 0.35651928f, 0.36023882f, 0.363944f, 0.36763483f, 0.37131137f, 0.37497362f, 0.37862164f, 0.3822554f, 0.385875f, 0.3894804f, 0.3930717f, 0.39664888f, 0.40021196f, 0.403761f, 0.407296f, 0.410817f, 0.41432405f, 0.41781712f, 0.4212963f, 0.4247616f, 0.428213f, 0.43165058f, 0.43507436f, 0.43848437f, 0.44188064f, 0.44526315f, 0.448632f, 0.45198718f, 0.4553287f, 0.45865664f, 0.46197096f, 0.46527174f, 0.468559f, 0.47183275f, 0.47509304f, 0.47833988f, 0.48157328f, 0.48479334f, 0.488f, 0.49119332f, 0.49437338f, 0.49754012f, 0.5006936f, 0.5038339f, 0.506961f, 0.5100749f, 0.5131757f, 0.51626337f, 0.51933795f, 0.5223995f, 0.525448f, 0.5284835f, 0.53150606f, 0.5345156f, 0.5375123f, 0.54049605f, 0.543467f, 0.5464251f, 0.54937035f, 0.5523029f, 0.55522263f, 0.55812967f, 0.561024f, 0.56390566f, 0.5667747f, 0.5696311f, 0.57247496f, 0.57530624f, 0.578125f, 0.58093125f, 0.58372504f, 0.58650637f, 0.5892753f, 0.59203184f, 0.594776f, 0.59750783f, 0.60022736f, 0.6029346f, 0.6056296f, 0.6083124f, 0.610983f, 0.61364144f, 0.6162877f, 0.6189219f, 0.62154394f, 0.624154f, 0.626752f, 0.629338f, 0.63191205f, 0.6344741f, 0.6370243f, 0.6395626f, 0.642089f, 0.6446036f, 0.64710635f, 0.64959735f, 0.6520766f, 0.6545442f, 0.657f, 0.65944415f, 0.6618767f, 0.66429764f, 0.666707f, 0.66910475f, 0.671491f, 0.67386574f, 0.67622906f, 0.6785809f, 0.6809213f, 0.6832503f, 0.685568f, 0.6878743f, 0.6901694f, 0.69245315f, 0.69472563f, 0.6969869f, 0.699237f, 0.7014759f, 0.7037037f, 0.7059204f, 0.70812595f, 0.7103205f, 0.712504f, 0.7146765f, 0.71683806f, 0.7189886f, 0.7211283f, 0.72325706f, 0.725375f, 0.7274821f, 0.7295784f, 0.7316639f, 0.7337386f, 0.73580265f, 0.737856f, 0.7398987f, 0.7419307f, 0.7439521f, 0.745963f, 0.74796325f, 0.749953f, 0.75193226f, 0.75390106f, 0.7558594f, 0.7578073f, 0.7597448f, 0.761672f, 0.76358885f, 0.76549536f, 0.7673916f, 0.76927763f, 0.7711534f, 0.773019f, 0.77487445f, 0.7767197f, 0.77855486f, 0.78037995f, 0.782195f, 0.784f, 0.78579503f, 0.78758f, 0.7893551f, 0.7911203f, 0.7928756f, 0.794621f, 0.79635656f, 0.79808235f, 0.79979837f, 0.8015046f, 0.80320114f, 0.804888f, 0.80656517f, 0.8082327f, 0.8098906f, 0.81153893f, 0.81317776f, 0.814807f, 0.81642675f, 0.81803703f, 0.8196379f, 0.8212293f, 0.8228113f, 0.824384f, 0.82594734f, 0.82750136f, 0.82904613f, 0.8305816f, 0.8321079f, 0.833625f, 0.8351329f, 0.8366317f, 0.83812135f, 0.83960193f, 0.8410735f, 0.842536f, 0.8439895f, 0.845434f, 0.84686965f, 0.8482963f, 0.8497141f, 0.851123f, 0.8525231f, 0.8539144f, 0.85529685f, 0.8566706f, 0.8580357f, 0.859392f, 0.86073965f, 0.8620787f, 0.8634091f, 0.86473095f, 0.8660442f, 0.867349f, 0.86864525f, 0.869933f, 0.87121236f, 0.8724833f, 0.8737458f, 0.875f, 0.87624586f, 0.87748337f, 0.87871265f, 0.87993366f, 0.88114643f, 0.882351f, 0.8835474f, 0.8847357f, 0.8859159f, 0.88708794f, 0.888252f, 0.889408f, 0.890556f, 0.89169604f, 0.8928281f, 0.8939523f, 0.8950686f, 0.896177f, 0.8972776f, 0.8983704f, 0.89945537f, 0.9005326f, 0.90160215f, 0.902664f, 0.9037182f, 0.9047647f, 0.9058036f, 0.90683496f, 0.9078587f, 0.908875f, 0.90988374f, 0.91088504f, 0.9118789f, 0.9128653f, 0.91384435f, 0.914816f, 0.91578037f, 0.9167374f, 0.9176871f, 0.91862965f, 0.9195649f, 0.920493f, 0.9214139f, 0.9223277f, 0.9232344f, 0.92413396f, 0.9250265f, 0.925912f, 0.9267905f, 0.927662f, 0.92852664f, 0.9293843f, 0.9302351f, 0.931079f, 0.9319161f, 0.93274635f, 0.93356985f, 0.9343866f, 0.93519664f, 0.936f, 0.93679667f, 0.9375867f, 0.9383701f, 0.93914694f, 0.93991727f, 0.940681f, 0.94143826f, 0.94218904f, 0.9429334f, 0.9436713f, 0.9444028f, 0.945128f, 0.94584686f, 0.94655937f, 0.9472656f, 0.9479656f, 0.9486594f, 0.949347f, 0.9500284f, 0.9507037f, 0.95137286f, 0.95203596f, 0.952693f, 0.953344f, 0.953989f, 0.95462805f, 0.9552611f, 0.9558883f, 0.9565096f, 0.957125f, 0.9577346f, 0.9583384f, 0.9589364f, 0.9595286f, 0.96011513f, 0.960696f, 0.96127117f, 0.9618407f, 0.9624046f, 0.962963f, 0.96351576f, 0.964063f, 0.96460474f, 0.96514106f, 0.9656719f, 0.9661973f, 0.9667173f, 0.967232f, 0.9677413f, 0.9682454f, 0.9687441f, 0.9692376f, 0.9697259f, 0.970209f, 0.9706869f, 0.9711597f, 0.97162735f, 0.97208995f, 0.9725475f, 0.973f, 0.9734475f, 0.97389007f, 0.9743276f, 0.9747603f, 0.9751881f, 0.975611f, 0.9760291f, 0.9764424f, 0.97685087f, 0.9772546f, 0.9776537f, 0.978048f, 0.97843766f, 0.9788227f, 0.9792031f, 0.979579f, 0.97995025f, 0.980317f, 0.9806793f, 0.981037f, 0.98139036f, 0.9817393f, 0.98208386f, 0.982424f, 0.98275983f, 0.98309135f, 0.98341864f, 0.98374164f, 0.9840604f, 0.984375f, 0.9846854f, 0.9849917f, 0.98529387f, 0.98559195f, 0.985886f, 0.986176f, 0.986462f, 0.98674405f, 0.9870221f, 0.9872963f, 0.9875666f, 0.987833f, 0.9880956f, 0.9883544f, 0.9886094f, 0.9888606f, 0.98910815f, 0.989352f, 0.9895922f, 0.9898287f, 0.99006164f, 0.99029094f, 0.9905167f, 0.990739f, 0.99095774f, 0.991173f, 0.99138486f, 0.9915933f, 0.99179834f, 0.992f, 0.99219835f, 0.9923934f, 0.9925851f, 0.99277365f, 0.9929589f, 0.993141f, 0.9933199f, 0.9934957f, 0.9936684f, 0.99383795f, 0.9940045f, 0.994168f, 0.9943285f, 0.99448603f, 0.99464065f, 0.9947923f, 0.99494106f, 0.995087f, 0.9952301f, 0.9953704f, 0.9955079f, 0.9956426f, 0.9957747f, 0.995904f, 0.9960307f, 0.9961547f, 0.99627614f, 0.996395f, 0.9965112f, 0.996625f, 0.9967362f, 0.99684507f, 0.9969514f, 0.9970553f, 0.99715686f, 0.997256f, 0.99735284f, 0.9974474f, 0.99753964f, 0.99762964f, 0.99771744f, 0.997803f, 0.9978864f, 0.9979677f, 0.9980469f, 0.99812394f, 0.998199f, 0.998272f, 0.998343f, 0.998412f, 0.9984791f, 0.9985443f, 0.9986076f, 0.998669f, 0.9987286f, 0.9987864f, 0.99884236f, 0.99889666f, 0.99894917f, 0.999f, 0.9990492f, 0.9990967f, 0.99914265f, 0.999187f, 0.9992297f, 0.999271f, 0.99931073f, 0.99934906f, 0.9993859f, 0.9994213f, 0.99945533f, 0.999488f, 0.99951935f, 0.9995494f, 0.9995781f, 0.99960566f, 0.99963194f, 0.999657f, 0.99968094f, 0.9997037f, 0.9997254f, 0.99974597f, 0.9997655f, 0.999784f, 0.9998015f, 0.999818f, 0.99983364f, 0.9998483f, 0.9998621f, 0.999875f, 0.9998871f, 0.9998984f, 0.99990886f, 0.99991864f, 0.99992764f, 0.999936f, 0.9999437f, 0.9999507f, 0.99995714f, 0.999963f, 0.99996823f, 0.999973f, 0.99997723f, 0.99998105f, 0.9999844f, 0.9999873f, 0.9999898f, 0.999992f, 0.99999386f, 0.99999535f, 0.9999966f, 0.9999976f, 0.9999984f, 0.999999f, 0.9999994f, 0.9999997f, 0.9999999f, 0.99999994f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f};
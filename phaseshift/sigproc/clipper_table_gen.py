@@ -47,14 +47,24 @@ def softclipper01_table_build(xs_table_vmax):
 
     # plt.plot(xs_table, ys_table, 'g')
 
+    # Pad to a multiple of 16 floats with the saturated value, so the
+    # library can index one past the last entry and point SIMD gathers at
+    # the static array directly (see lookup_table_clipper01).
+    padded_size = (len(ys_table) + 15) // 16 * 16
+    ys_padded = np.concatenate((ys_table, np.full(padded_size - len(ys_table), ys_table[-1], dtype=np.float32)))
+
     lf = open("clipper_table.h", "w")
     lf.write(f"// Generated by clipper_table_gen.py\n")
-    lf.write(f"float g_clipper_table_xmin = {0.0}f;\n")
-    lf.write(f"float g_clipper_table_xmax = {xs_table[-1]}f;\n")
-    lf.write(f"int g_clipper_table_size = {len(ys_table)};\n")
-    lf.write(f"float g_clipper_table_step = {xs_table_step}f;\n")
-    lf.write("const static float g_clipper_table[] = {")
-    lf.write(", ".join([str(y)+'f' for y in ys_table]))
+    lf.write("// The table is read-only and known at compile time: it lives in .rodata\n")
+    lf.write("// (constexpr), cache-line aligned and padded to a multiple of 16 floats\n")
+    lf.write("// with its saturated value, so lookup_table_clipper01 points straight at\n")
+    lf.write("// it instead of duplicating it on the heap.\n")
+    lf.write(f"constexpr float g_clipper_table_xmin = {0.0}f;\n")
+    lf.write(f"constexpr float g_clipper_table_xmax = {xs_table[-1]}f;\n")
+    lf.write(f"constexpr int g_clipper_table_size = {len(ys_table)};\n")
+    lf.write(f"constexpr float g_clipper_table_step = {xs_table_step}f;\n")
+    lf.write("alignas(64) constexpr float g_clipper_table[] = {")
+    lf.write(", ".join([str(y)+'f' for y in ys_padded]))
     lf.write("};\n")
     lf.close()
 
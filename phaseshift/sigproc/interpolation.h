@@ -10,6 +10,7 @@
 
 #include <cstddef>
 #include <cmath>
+#include <algorithm>
 
 #include <phaseshift/lookup_table.h>
 #include <phaseshift/containers/vector.h>
@@ -33,6 +34,51 @@ namespace phaseshift {
         return (1.0f-g)*src[n] + g*src[n+1];
     }
 
+    //! Batched form of interp_linear over a run of query positions, for
+    //! resampler-style callers: 8 queries per iteration on AVX2, the two
+    //! neighbours fetched with gathers and the boundary handling done with
+    //! min/max clamps instead of two branches per query.
+    inline void interp_linear_batch(const float* PHASESHIFT_RESTRICT src, int src_size,
+                                    const float* PHASESHIFT_RESTRICT nfs, int size,
+                                    float* PHASESHIFT_RESTRICT out) {
+        assert(src_size > 0);
+        if (src_size == 1) {
+            for (int i = 0; i < size; ++i)
+                out[i] = src[0];
+            return;
+        }
+        int i = 0;
+        #if defined(PHASESHIFT_SIMD_X86) && defined(__AVX2__)
+        {
+            // The index is capped at src_size-2 so a query landing exactly
+            // on the last point reads it through g=1 and the gathers never
+            // leave the array.
+            const __m256 vzero = _mm256_setzero_ps();
+            const __m256 vcap = _mm256_set1_ps(static_cast<float>(src_size-1));
+            const __m256i idxcap = _mm256_set1_epi32(src_size-2);
+            const __m256i ione = _mm256_set1_epi32(1);
+            for (; i+8 <= size; i += 8) {
+                __m256 nfv = _mm256_max_ps(_mm256_min_ps(_mm256_loadu_ps(nfs+i), vcap), vzero);
+                __m256i idx = _mm256_min_epi32(_mm256_cvttps_epi32(nfv), idxcap);
+                __m256 g = _mm256_sub_ps(nfv, _mm256_cvtepi32_ps(idx));
+                __m256 v0 = _mm256_i32gather_ps(src, idx, 4);
+                __m256 v1 = _mm256_i32gather_ps(src, _mm256_add_epi32(idx, ione), 4);
+                #if defined(__FMA__)
+                    _mm256_storeu_ps(out+i, _mm256_fmadd_ps(g, _mm256_sub_ps(v1, v0), v0));
+                #else
+                    _mm256_storeu_ps(out+i, _mm256_add_ps(v0, _mm256_mul_ps(g, _mm256_sub_ps(v1, v0))));
+                #endif
+            }
+        }
+        #endif
+        for (; i < size; ++i) {
+            float nf = std::min(std::max(nfs[i], 0.0f), static_cast<float>(src_size-1));
+            int n = std::min(static_cast<int>(nf), src_size-2);
+            float g = nf - n;
+            out[i] = (1.0f-g)*src[n] + g*src[n+1];
+        }
+    }
+
     //! Linear interpolation by means of a time instant `t`.
     //  Values are indexed by a given series of time instant `pts`.
     //  So the distance between subsequent points can be not constant.
@@ -40,16 +86,31 @@ namespace phaseshift {
     class interp_linear_increasing_t {
         phaseshift::vector<float>* m_pts = nullptr;
         phaseshift::vector<float>* m_pvs = nullptr;
+        // Raw base pointers, size and current inverse segment length are
+        // cached at reset() time: operator queries are on the hot path of
+        // monotonic streams, so they should not re-dereference the
+        // containers (two dependent loads each) nor re-divide by the
+        // segment length on every call.
+        const float* m_pts_data = nullptr;
+        const float* m_pvs_data = nullptr;
+        int m_size = 0;
+        float m_inv_seg = 0.0f;
         int m_n = 0;
      public:
 
         inline void reset() {
             m_n = 0;
+            if (m_size >= 2)
+                m_inv_seg = 1.0f/(m_pts_data[1]-m_pts_data[0]);
         }
 
         inline void reset(phaseshift::vector<float>* pts, phaseshift::vector<float>* pvs) {
             m_pts = pts;
             m_pvs = pvs;
+            assert(pts->size() == pvs->size());
+            m_pts_data = pts->data();
+            m_pvs_data = pvs->data();
+            m_size = pts->size();
             reset();
         }
 
@@ -62,39 +123,60 @@ namespace phaseshift {
             assert(m_pvs != nullptr);
             assert(m_pts->size() == m_pvs->size());
             assert(m_pvs->size() > 0);
+            assert(m_pts_data == m_pts->data());  // reset() must follow any reallocation
 
             int n = m_n;
+            float inv_seg = m_inv_seg;
 
-            if ((n == 0) && (t <= (*m_pts)[0]))
-                return (*m_pvs)[0];
+            // No n==0 precondition: with the out-of-order fallback below a
+            // query under the first point can arrive while n is anywhere.
+            if (t <= m_pts_data[0])
+                return m_pvs_data[0];
 
-            if (t >= (*m_pts)[m_pts->size()-1]) {
+            if (t >= m_pts_data[m_size-1]) {
                 if (auto_increase) {
                     m_n = n;
                 }
-                return (*m_pvs)[m_pvs->size()-1];
+                return m_pvs_data[m_size-1];
+            }
+
+            // A backward query (a caller that missed reset()) or a jump
+            // far past the current segment would leave the linear scan
+            // O(N) per call: locate the segment in O(log N) first, and
+            // let the scan below finish the few remaining steps. The
+            // monotonic fast path costs one extra well-predicted compare.
+            if ((t < m_pts_data[n]) || ((n+8 < m_size) && (t > m_pts_data[n+8]))) {
+                n = static_cast<int>(std::lower_bound(m_pts_data, m_pts_data+m_size, static_cast<float>(t)) - m_pts_data) - 1;
+                n = std::clamp(n, 0, m_size-2);
+                inv_seg = 1.0f/(m_pts_data[n+1]-m_pts_data[n]);
             }
 
-            while ((n+1 < m_pts->size()-1) && (t > (*m_pts)[n+1]))
+            // The division only runs when the query leaves the current
+            // segment, which is rare for the monotonic streams this class
+            // serves; within a segment the cached inverse is reused.
+            while ((n+1 < m_size-1) && (t > m_pts_data[n+1])) {
                 n++;
+                inv_seg = 1.0f/(m_pts_data[n+1]-m_pts_data[n]);
+            }
 
-            if (n >= m_pts->size()-1) {
+            if (n >= m_size-1) {
                 if (auto_increase) {
                     m_n = n;
                 }
-                return (*m_pvs)[m_pvs->size()-1];
+                return m_pvs_data[m_size-1];
             }
 
-            assert(n < m_pts->size());
-            assert(n+1 < m_pts->size());
+            assert(n < m_size);
+            assert(n+1 < m_size);
 
-            float g = static_cast<float>((t-(*m_pts)[n]) / ((*m_pts)[n+1]-(*m_pts)[n]));
+            float g = static_cast<float>((t-m_pts_data[n]) * inv_seg);
 
             if (auto_increase) {
                 m_n = n;
+                m_inv_seg = inv_seg;
             }
 
-            return (1.0f-g)*(*m_pvs)[n] + g*(*m_pvs)[n+1];
+            return (1.0f-g)*m_pvs_data[n] + g*m_pvs_data[n+1];
         }
     };
 
@@ -152,6 +234,101 @@ namespace phaseshift {
     }
 
 
+    namespace detail {
+        // Tournament argmin/argmax over the compile-time range [LO, LO+COUNT):
+        // the recursion halves the range, so the emitted code is a balanced
+        // tree of selects with depth log2(COUNT) instead of a serial loop
+        // with a bounds check per element. Ties resolve to the lower index,
+        // matching the strict comparisons of the runtime argmin/argmax.
+        template<int LO, int COUNT, typename value_type, typename array_type>
+        inline void argmin_n(const array_type& ys, int* pidx, value_type* pval) {
+            if constexpr (COUNT == 1) {
+                *pidx = LO;
+                *pval = ys[LO];
+            } else {
+                int li, ri;
+                value_type lv, rv;
+                argmin_n<LO, COUNT/2, value_type>(ys, &li, &lv);
+                argmin_n<LO+COUNT/2, COUNT-COUNT/2, value_type>(ys, &ri, &rv);
+                *pidx = (rv < lv) ? ri : li;
+                *pval = (rv < lv) ? rv : lv;
+            }
+        }
+        template<int LO, int COUNT, typename value_type, typename array_type>
+        inline void argmax_n(const array_type& ys, int* pidx, value_type* pval) {
+            if constexpr (COUNT == 1) {
+                *pidx = LO;
+                *pval = ys[LO];
+            } else {
+                int li, ri;
+                value_type lv, rv;
+                argmax_n<LO, COUNT/2, value_type>(ys, &li, &lv);
+                argmax_n<LO+COUNT/2, COUNT-COUNT/2, value_type>(ys, &ri, &rv);
+                *pidx = (rv > lv) ? ri : li;
+                *pval = (rv > lv) ? rv : lv;
+            }
+        }
+    }  // namespace detail
+
+    //! Same fit as parabolic_fit_minima for callsites where the array size is
+    //! a compile-time constant (small candidate windows in peak pickers):
+    //! the argmin unrolls completely, which pays off for N up to a few tens.
+    template<int N, typename value_type, typename array_type>
+    inline void parabolic_fit_minima_n(const array_type& ys, int* pmin_idx, value_type* pmin_df, value_type* pmin_val=nullptr) {
+        static_assert(N >= 1, "parabolic_fit_minima_n needs at least one element");
+        assert(static_cast<int>(ys.size()) >= N);
+        int minidx;
+        value_type minv;
+        detail::argmin_n<0, N, value_type>(ys, &minidx, &minv);
+        *pmin_idx = minidx;
+        *pmin_df = 0.0f;
+        if (pmin_val != nullptr) *pmin_val = minv;
+        if (minidx > 0 && minidx < N - 1) {
+            value_type y_m1 = ys[minidx - 1];
+            value_type y    = minv;
+            value_type y_p1 = ys[minidx + 1];
+            if ((y_m1 > y) && (y < y_p1)) {
+                value_type A = static_cast<value_type>(0.5) * (y_m1 + y_p1) - y;
+                if (A > 0.0f) {
+                    value_type B = static_cast<value_type>(0.5) * (y_p1 - y_m1);
+                    value_type C = y;
+                    value_type min_df = -B / (static_cast<value_type>(2.0) * A);
+                    *pmin_df = min_df;
+                    if (pmin_val != nullptr) *pmin_val = A * min_df * min_df + B * min_df + C;
+                }
+            }
+        }
+    }
+
+    //! Compile-time size variant of parabolic_fit_maxima, see parabolic_fit_minima_n.
+    template<int N, typename value_type, typename array_type>
+    inline void parabolic_fit_maxima_n(const array_type& ys, int* pmax_idx, value_type* pmax_df, value_type* pmax_val=nullptr) {
+        static_assert(N >= 1, "parabolic_fit_maxima_n needs at least one element");
+        assert(static_cast<int>(ys.size()) >= N);
+        int maxidx;
+        value_type maxv;
+        detail::argmax_n<0, N, value_type>(ys, &maxidx, &maxv);
+        *pmax_idx = maxidx;
+        *pmax_df = 0.0f;
+        if (pmax_val != nullptr) *pmax_val = maxv;
+        if (maxidx > 0 && maxidx < N - 1) {
+            value_type y_m1 = ys[maxidx - 1];
+            value_type y    = maxv;
+            value_type y_p1 = ys[maxidx + 1];
+            if ((y_m1 < y) && (y > y_p1)) {
+                value_type A = static_cast<value_type>(0.5) * (y_m1 + y_p1) - y;
+                if (A < 0.0f) {
+                    value_type B = static_cast<value_type>(0.5) * (y_p1 - y_m1);
+                    value_type C = y;
+                    value_type max_df = -B / (static_cast<value_type>(2.0) * A);
+                    *pmax_df = max_df;
+                    if (pmax_val != nullptr) *pmax_val = A * max_df * max_df + B * max_df + C;
+                }
+            }
+        }
+    }
+
+
     // Sinc -------------------------------------------------------------------
 
     inline float sinc(float x) {
@@ -187,6 +364,55 @@ namespace phaseshift {
         return w;
     }
 
+    //! Polyphase table of the raised-cosine kernel: `beta` and the tap
+    //! count are fixed per session, so the sin/cos/divisions of
+    //! raisedcosin_weight(.) are paid once at build() time and the
+    //! resampling inner loop reads tabulated taps instead (the
+    //! space-for-time counterpart of the lookup tables, but exact at the
+    //! tabulated offsets since the phase grid is known).
+    class raisedcosin_kernel_t {
+        phaseshift::vector<float> m_lut;
+        int m_nphases = 0;
+        int m_ntaps = 0;
+     public:
+
+        //! Tabulate `ntaps` kernel values at `nphases` fractional offsets:
+        //! row `phase` holds raisedcosin_weight(tap - ntaps/2 - phase/nphases, beta)
+        //! for each tap, i.e. the filter branch for a fractional delay of
+        //! phase/nphases samples.
+        inline void build(int ntaps, int nphases, float beta) {
+            assert(ntaps > 0);
+            assert(nphases > 0);
+            m_ntaps = ntaps;
+            m_nphases = nphases;
+            m_lut.resize_allocation(ntaps*nphases);
+            m_lut.resize(ntaps*nphases);
+            const int center = ntaps/2;
+            for (int phase = 0; phase < nphases; ++phase) {
+                const float frac = static_cast<float>(phase)/nphases;
+                for (int tap = 0; tap < ntaps; ++tap)
+                    m_lut[phase*ntaps + tap] = raisedcosin_weight(static_cast<float>(tap-center)-frac, beta);
+            }
+        }
+
+        inline bool valid() const {return m_lut.size() > 0;}
+        inline int ntaps() const {return m_ntaps;}
+        inline int nphases() const {return m_nphases;}
+
+        inline float operator()(int phase, int tap) const {
+            assert(phase >= 0 && phase < m_nphases);
+            assert(tap >= 0 && tap < m_ntaps);
+            return m_lut[phase*m_ntaps + tap];
+        }
+
+        //! Contiguous tap row of one polyphase branch, for convolution
+        //! loops streaming the taps directly.
+        inline const float* row(int phase) const {
+            assert(phase >= 0 && phase < m_nphases);
+            return m_lut.data() + phase*m_ntaps;
+        }
+    };
+
 }  // namespace phaseshift
 
 #endif  // PHASESHIFT_INTERPOLATION_H_
@@ -0,0 +1,96 @@
+// Copyright (C) 2025 Gilles Degottex <gilles.degottex@gmail.com> All Rights Reserved.
+//
+// You may use, distribute and modify this code under the
+// terms of the Apache 2.0 license.
+// If you don't have a copy of this license, please visit:
+//     https://github.com/gillesdegottex/phaseshift
+
+#include <phaseshift/sigproc/interpolation.h>
+
+#include <snitch/snitch.hpp>
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+TEST_CASE("interpolation_interp_linear_batch", "[interpolation]") {
+    const int src_size = 16;
+    std::vector<float> src(src_size);
+    for (int n = 0; n < src_size; ++n) {
+        src[n] = std::sin(0.3f*n) + 0.1f*n;
+    }
+
+    // 21 queries: the 8-wide body runs twice and the scalar tail takes
+    // the rest. Every result must match interp_linear on the same data.
+    const int size = 21;
+    std::vector<float> nfs(size);
+    uint32_t state = 123456789u;
+    for (int i = 0; i < size; ++i) {
+        state = 1664525u*state + 1013904223u;
+        nfs[i] = static_cast<float>(state % 20000u) / 20000.0f * (src_size-1);
+    }
+    nfs[0] = 0.0f;                               // exactly on the first point
+    nfs[1] = static_cast<float>(src_size-1);     // exactly on the last point
+    nfs[2] = -3.5f;                              // clamps to src[0]
+    nfs[3] = static_cast<float>(src_size)+2.0f;  // clamps to src[src_size-1]
+    nfs[4] = 7.0f;                               // exactly on a grid point
+    nfs[19] = -1.0f;                             // clamps in the scalar tail
+    nfs[20] = static_cast<float>(src_size-1)+0.5f;
+
+    std::vector<float> out(size);
+    phaseshift::interp_linear_batch(src.data(), src_size, nfs.data(), size, out.data());
+    for (int i = 0; i < size; ++i) {
+        REQUIRE(std::abs(out[i] - phaseshift::interp_linear(src, nfs[i])) < 1e-6f);
+    }
+    // g==0 queries reproduce the sample exactly; the g==1 ones (last
+    // point reached through the capped index) go through the fmadd and
+    // may be one ulp off, hence the tolerance above for those.
+    REQUIRE(out[0] == src[0]);
+    REQUIRE(out[2] == src[0]);
+    REQUIRE(out[19] == src[0]);
+    REQUIRE(std::abs(out[1] - src[src_size-1]) < 1e-6f);
+    REQUIRE(std::abs(out[3] - src[src_size-1]) < 1e-6f);
+    REQUIRE(std::abs(out[4] - src[7]) < 1e-6f);
+    REQUIRE(std::abs(out[20] - src[src_size-1]) < 1e-6f);
+
+    // src_size == 1 splats the single sample whatever the queries say.
+    const float single = 0.25f;
+    phaseshift::interp_linear_batch(&single, 1, nfs.data(), size, out.data());
+    for (int i = 0; i < size; ++i) {
+        REQUIRE(out[i] == single);
+    }
+
+    // src_size == 2: the index cap keeps both gathers inside the array
+    // while queries beyond the ends still clamp.
+    const float pair[2] = {1.0f, 3.0f};
+    phaseshift::interp_linear_batch(pair, 2, nfs.data(), size, out.data());
+    for (int i = 0; i < size; ++i) {
+        const float nf = std::min(std::max(nfs[i], 0.0f), 1.0f);
+        REQUIRE(std::abs(out[i] - ((1.0f-nf)*pair[0] + nf*pair[1])) < 1e-6f);
+    }
+}
+
+TEST_CASE("interpolation_parabolic_fit", "[interpolation]") {
+    // Samples of 2*(x-5.3)^2 + 1: the fit must recover the vertex.
+    std::vector<float> ys(11);
+    for (int n = 0; n < static_cast<int>(ys.size()); ++n) {
+        ys[n] = 2.0f*(n-5.3f)*(n-5.3f) + 1.0f;
+    }
+
+    int min_idx;
+    float min_df, min_val;
+    phaseshift::parabolic_fit_minima(ys, &min_idx, &min_df, &min_val);
+    REQUIRE(min_idx == 5);
+    REQUIRE(std::abs(min_idx+min_df - 5.3f) < 1e-4f);
+    REQUIRE(std::abs(min_val - 1.0f) < 1e-4f);
+
+    for (int n = 0; n < static_cast<int>(ys.size()); ++n) {
+        ys[n] = -ys[n];
+    }
+    int max_idx;
+    float max_df, max_val;
+    phaseshift::parabolic_fit_maxima(ys, &max_idx, &max_df, &max_val);
+    REQUIRE(max_idx == 5);
+    REQUIRE(std::abs(max_idx+max_df - 5.3f) < 1e-4f);
+    REQUIRE(std::abs(max_val + 1.0f) < 1e-4f);
+}
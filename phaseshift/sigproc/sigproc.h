@@ -10,31 +10,173 @@
 
 #include <phaseshift/utils.h>
 #include <phaseshift/lookup_table.h>
+#include <phaseshift/containers/utils.h>
 
 #include <algorithm>
 #include <complex>
+#include <random>
+
+// Runtime CPU dispatch of the contiguous-float cores below, following the
+// audio_block/wav_convert pattern: on an x86-64 baseline compiled below AVX2
+// the cores jump through a kernel table selected once from the cpu flags
+// (see sigproc_dispatch.h), so a portable build still reaches the AVX2
+// bodies on capable machines. A baseline already carrying AVX2 keeps the
+// direct inline path. The kernel translation units define
+// PHASESHIFT_SIGPROC_KERNELS_TU to get the raw bodies, with internal
+// linkage: with the default external inline linkage the linker would merge
+// the AVX2 and baseline instances into one, and whichever copy survived
+// would decide the ISA for every caller.
+#if defined(__x86_64__) && !defined(__AVX2__) && !defined(PHASESHIFT_SIGPROC_KERNELS_TU) && (defined(__GNUC__) || defined(__clang__))
+    #define PHASESHIFT_SIGPROC_DISPATCH 1
+    #include <phaseshift/sigproc/sigproc_dispatch.h>
+#endif
+#if defined(PHASESHIFT_SIGPROC_KERNELS_TU)
+    #define PHASESHIFT_SIGPROC_CORE static inline
+#else
+    #define PHASESHIFT_SIGPROC_CORE inline
+#endif
 
 namespace phaseshift {
 
+    #if defined(PHASESHIFT_SIMD_X86) && defined(__AVX2__)
+    //! Sum of the 8 lanes of an AVX2 register.
+    inline float reduce_add(__m256 v) {
+        __m128 s = _mm_add_ps(_mm256_castps256_ps128(v), _mm256_extractf128_ps(v, 1));
+        s = _mm_add_ps(s, _mm_movehl_ps(s, s));
+        s = _mm_add_ss(s, _mm_shuffle_ps(s, s, 1));
+        return _mm_cvtss_f32(s);
+    }
+    //! Product of the 8 lanes of an AVX2 register.
+    inline float reduce_mul(__m256 v) {
+        __m128 s = _mm_mul_ps(_mm256_castps256_ps128(v), _mm256_extractf128_ps(v, 1));
+        s = _mm_mul_ps(s, _mm_movehl_ps(s, s));
+        s = _mm_mul_ss(s, _mm_shuffle_ps(s, s, 1));
+        return _mm_cvtss_f32(s);
+    }
+    #elif defined(PHASESHIFT_SIMD_NEON)
+    //! Sum of the 4 lanes of a NEON register.
+    inline float reduce_add(float32x4_t v) {
+        #if defined(__aarch64__)
+            return vaddvq_f32(v);
+        #else
+            float32x2_t s = vadd_f32(vget_low_f32(v), vget_high_f32(v));
+            return vget_lane_f32(vpadd_f32(s, s), 0);
+        #endif
+    }
+    //! Product of the 4 lanes of a NEON register.
+    inline float reduce_mul(float32x4_t v) {
+        float32x2_t s = vmul_f32(vget_low_f32(v), vget_high_f32(v));
+        return vget_lane_f32(s, 0) * vget_lane_f32(s, 1);
+    }
+    #endif
+
+    //! Pointer+length core of argmin, 8 lanes per iteration on AVX2:
+    //! candidate values and their indices race in parallel registers and
+    //! the 8 lane winners are reduced at the end. Ties resolve to the
+    //! smallest index, i.e. the first occurrence, like the scalar scan.
+    PHASESHIFT_SIGPROC_CORE int argmin(const float* PHASESHIFT_RESTRICT in, int size) {
+        #if defined(PHASESHIFT_SIGPROC_DISPATCH)
+        return sigproc_get().argmin(in, size);
+        #else
+        assert(size > 0);
+        float val = in[0];
+        int idx = 0;
+        int n = 1;
+        #if defined(PHASESHIFT_SIMD_X86) && defined(__AVX2__)
+        if (size >= 16) {
+            __m256 vbest = _mm256_loadu_ps(in);
+            __m256i vbestidx = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+            __m256i vcuridx = vbestidx;
+            const __m256i vinc = _mm256_set1_epi32(8);
+            for (n = 8; n+8 <= size; n += 8) {
+                vcuridx = _mm256_add_epi32(vcuridx, vinc);
+                __m256 v = _mm256_loadu_ps(in+n);
+                __m256 lt = _mm256_cmp_ps(v, vbest, _CMP_LT_OQ);
+                vbest = _mm256_blendv_ps(vbest, v, lt);
+                vbestidx = _mm256_blendv_epi8(vbestidx, vcuridx, _mm256_castps_si256(lt));
+            }
+            alignas(32) float vals[8];
+            alignas(32) int idxs[8];
+            _mm256_store_ps(vals, vbest);
+            _mm256_store_si256(reinterpret_cast<__m256i*>(idxs), vbestidx);
+            val = vals[0];
+            idx = idxs[0];
+            // Lane j only ever held indices congruent to j mod 8, so the
+            // first occurrence is the smallest index among equal winners.
+            for (int j = 1; j < 8; ++j) {
+                if ((vals[j] < val) || ((vals[j] == val) && (idxs[j] < idx))) {
+                    val = vals[j];
+                    idx = idxs[j];
+                }
+            }
+        }
+        #elif defined(PHASESHIFT_SIMD_NEON)
+        // 4-lane NEON tier of the same race: vbsl takes the role of the
+        // blends, the indices ride in an u32 register.
+        if (size >= 8) {
+            const uint32_t lane_idx[4] = {0u, 1u, 2u, 3u};
+            float32x4_t vbest = vld1q_f32(in);
+            uint32x4_t vbestidx = vld1q_u32(lane_idx);
+            uint32x4_t vcuridx = vbestidx;
+            const uint32x4_t vinc = vdupq_n_u32(4u);
+            for (n = 4; n+4 <= size; n += 4) {
+                vcuridx = vaddq_u32(vcuridx, vinc);
+                float32x4_t v = vld1q_f32(in+n);
+                uint32x4_t lt = vcltq_f32(v, vbest);
+                vbest = vbslq_f32(lt, v, vbest);
+                vbestidx = vbslq_u32(lt, vcuridx, vbestidx);
+            }
+            float vals[4];
+            uint32_t idxs[4];
+            vst1q_f32(vals, vbest);
+            vst1q_u32(idxs, vbestidx);
+            val = vals[0];
+            idx = static_cast<int>(idxs[0]);
+            for (int j = 1; j < 4; ++j) {
+                if ((vals[j] < val) || ((vals[j] == val) && (static_cast<int>(idxs[j]) < idx))) {
+                    val = vals[j];
+                    idx = static_cast<int>(idxs[j]);
+                }
+            }
+        }
+        #endif
+        for (; n < size; ++n) {
+            if (in[n] < val) {
+                val = in[n];
+                idx = n;
+            }
+        }
+        assert(!std::isnan(val));
+        assert(!std::isinf(val));
+        return idx;
+        #endif
+    }
+
     template<typename T, typename array_type>
     inline int argmin(const array_type& array) {
         assert(array.size() > 0);
         if (array.size() == 1)  return 0;
 
-        T val = array[0];
-        assert(!std::isnan(val));
-        assert(!std::isinf(val));
-        int idx = 0;
-        for (int n=1; n < static_cast<int>(array.size()); ++n){
-            if (array[n] < val) {
-                val = array[n];
-                assert(!std::isnan(val));
-                assert(!std::isinf(val));
-                idx = n;
+        if constexpr (phaseshift::dev::has_contiguous_data<array_type>::value
+                      && std::is_same_v<typename array_type::value_type, float>
+                      && std::is_same_v<T, float>) {
+            return argmin(array.data(), static_cast<int>(array.size()));
+        } else {
+            // Like the pointer core: nan/inf asserted once on the winner,
+            // not on every new minimum.
+            T val = array[0];
+            int idx = 0;
+            for (int n=1; n < static_cast<int>(array.size()); ++n){
+                if (array[n] < val) {
+                    val = array[n];
+                    idx = n;
+                }
             }
-        }
 
-        return idx;
+            assert(!std::isnan(val));
+            assert(!std::isinf(val));
+            return idx;
+        }
     }
 
     template<typename T, typename array_type>
@@ -42,37 +184,119 @@ namespace phaseshift {
         assert(array.size() > 0);
         if (array.size() == 1)  return array[0];
 
+        // The nan/inf checks run once on the result instead of twice per
+        // element: per-element asserts made debug builds O(3N) and their
+        // branches kept the release loop from vectorizing to vminps.
         T val = array[0];
-        assert(!std::isnan(val));
-        assert(!std::isinf(val));
         for (int n=1; n < static_cast<int>(array.size()); ++n) {
             val = std::min<T>(val, array[n]);
-            assert(!std::isnan(val));
-            assert(!std::isinf(val));
         }
 
+        assert(!std::isnan(val));
+        assert(!std::isinf(val));
         return val;
     }
 
+    //! Pointer+length core of argmax, mirror of the argmin one above.
+    PHASESHIFT_SIGPROC_CORE int argmax(const float* PHASESHIFT_RESTRICT in, int size) {
+        #if defined(PHASESHIFT_SIGPROC_DISPATCH)
+        return sigproc_get().argmax(in, size);
+        #else
+        assert(size > 0);
+        float val = in[0];
+        int idx = 0;
+        int n = 1;
+        #if defined(PHASESHIFT_SIMD_X86) && defined(__AVX2__)
+        if (size >= 16) {
+            __m256 vbest = _mm256_loadu_ps(in);
+            __m256i vbestidx = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+            __m256i vcuridx = vbestidx;
+            const __m256i vinc = _mm256_set1_epi32(8);
+            for (n = 8; n+8 <= size; n += 8) {
+                vcuridx = _mm256_add_epi32(vcuridx, vinc);
+                __m256 v = _mm256_loadu_ps(in+n);
+                __m256 gt = _mm256_cmp_ps(v, vbest, _CMP_GT_OQ);
+                vbest = _mm256_blendv_ps(vbest, v, gt);
+                vbestidx = _mm256_blendv_epi8(vbestidx, vcuridx, _mm256_castps_si256(gt));
+            }
+            alignas(32) float vals[8];
+            alignas(32) int idxs[8];
+            _mm256_store_ps(vals, vbest);
+            _mm256_store_si256(reinterpret_cast<__m256i*>(idxs), vbestidx);
+            val = vals[0];
+            idx = idxs[0];
+            for (int j = 1; j < 8; ++j) {
+                if ((vals[j] > val) || ((vals[j] == val) && (idxs[j] < idx))) {
+                    val = vals[j];
+                    idx = idxs[j];
+                }
+            }
+        }
+        #elif defined(PHASESHIFT_SIMD_NEON)
+        if (size >= 8) {
+            const uint32_t lane_idx[4] = {0u, 1u, 2u, 3u};
+            float32x4_t vbest = vld1q_f32(in);
+            uint32x4_t vbestidx = vld1q_u32(lane_idx);
+            uint32x4_t vcuridx = vbestidx;
+            const uint32x4_t vinc = vdupq_n_u32(4u);
+            for (n = 4; n+4 <= size; n += 4) {
+                vcuridx = vaddq_u32(vcuridx, vinc);
+                float32x4_t v = vld1q_f32(in+n);
+                uint32x4_t gt = vcgtq_f32(v, vbest);
+                vbest = vbslq_f32(gt, v, vbest);
+                vbestidx = vbslq_u32(gt, vcuridx, vbestidx);
+            }
+            float vals[4];
+            uint32_t idxs[4];
+            vst1q_f32(vals, vbest);
+            vst1q_u32(idxs, vbestidx);
+            val = vals[0];
+            idx = static_cast<int>(idxs[0]);
+            for (int j = 1; j < 4; ++j) {
+                if ((vals[j] > val) || ((vals[j] == val) && (static_cast<int>(idxs[j]) < idx))) {
+                    val = vals[j];
+                    idx = static_cast<int>(idxs[j]);
+                }
+            }
+        }
+        #endif
+        for (; n < size; ++n) {
+            if (in[n] > val) {
+                val = in[n];
+                idx = n;
+            }
+        }
+        assert(!std::isnan(val));
+        assert(!std::isinf(val));
+        return idx;
+        #endif
+    }
+
     template<typename T, typename array_type>
     inline int argmax(const array_type& array) {
         assert(array.size() > 0);
         if (array.size() == 1)  return 0;
 
-        T val = array[0];
-        assert(!std::isnan(val));
-        assert(!std::isinf(val));
-        int idx = 0;
-        for (int n=1; n < static_cast<int>(array.size()); ++n){
-            if (array[n] > val) {
-                val = array[n];
-                assert(!std::isnan(val));
-                assert(!std::isinf(val));
-                idx = n;
+        if constexpr (phaseshift::dev::has_contiguous_data<array_type>::value
+                      && std::is_same_v<typename array_type::value_type, float>
+                      && std::is_same_v<T, float>) {
+            return argmax(array.data(), static_cast<int>(array.size()));
+        } else {
+            // Like the pointer core: nan/inf asserted once on the winner,
+            // not on every new maximum.
+            T val = array[0];
+            int idx = 0;
+            for (int n=1; n < static_cast<int>(array.size()); ++n){
+                if (array[n] > val) {
+                    val = array[n];
+                    idx = n;
+                }
             }
-        }
 
-        return idx;
+            assert(!std::isnan(val));
+            assert(!std::isinf(val));
+            return idx;
+        }
     }
 
     template<typename T, typename array_type>
@@ -80,28 +304,93 @@ namespace phaseshift {
         assert(array.size() > 0);
         if (array.size() == 1)  return array[0];
 
+        // Same single result check as min() above.
         T val = array[0];
-        assert(!std::isnan(val));
-        assert(!std::isinf(val));
         for (int n=1; n < static_cast<int>(array.size()); ++n) {
             val = std::max<T>(val, array[n]);
-            assert(!std::isnan(val));
-            assert(!std::isinf(val));
         }
 
+        assert(!std::isnan(val));
+        assert(!std::isinf(val));
         return val;
     }
 
+    //! Pointer+length core of sum, 8 lanes per iteration on AVX2.
+    PHASESHIFT_SIGPROC_CORE float sum(const float* PHASESHIFT_RESTRICT in, int size) {
+        #if defined(PHASESHIFT_SIGPROC_DISPATCH)
+        return sigproc_get().sum(in, size);
+        #else
+        float val = 0.0f;
+        int n = 0;
+        #if defined(PHASESHIFT_SIMD_X86) && defined(__AVX2__)
+        {
+            __m256 acc = _mm256_setzero_ps();
+            for (; n+8 <= size; n += 8)
+                acc = _mm256_add_ps(acc, _mm256_loadu_ps(in+n));
+            val = reduce_add(acc);
+        }
+        #elif defined(PHASESHIFT_SIMD_NEON)
+        {
+            float32x4_t acc = vdupq_n_f32(0.0f);
+            for (; n+4 <= size; n += 4)
+                acc = vaddq_f32(acc, vld1q_f32(in+n));
+            val = reduce_add(acc);
+        }
+        #endif
+        for (; n < size; ++n)
+            val += in[n];
+
+        return val;
+        #endif
+    }
+
     template<typename T, typename array_type>
     inline T sum(const array_type& array) {
         if (array.size() == 0)  return static_cast<T>(0);
         if (array.size() == 1)  return array[0];
 
-        T val = static_cast<T>(0);
-        for (int n=1; n < static_cast<int>(array.size()); ++n)
-            val += array[n];
+        if constexpr (phaseshift::dev::has_contiguous_data<array_type>::value
+                      && std::is_same_v<typename array_type::value_type, float>
+                      && std::is_same_v<T, float>) {
+            return sum(array.data(), static_cast<int>(array.size()));
+        } else {
+            // Accumulate from index 0: the former loop started at 1 and
+            // silently dropped the first element.
+            T val = static_cast<T>(0);
+            for (int n=0; n < static_cast<int>(array.size()); ++n)
+                val += array[n];
+
+            return val;
+        }
+    }
+
+    //! Pointer+length core of prod, 8 lanes per iteration on AVX2.
+    PHASESHIFT_SIGPROC_CORE float prod(const float* PHASESHIFT_RESTRICT in, int size) {
+        #if defined(PHASESHIFT_SIGPROC_DISPATCH)
+        return sigproc_get().prod(in, size);
+        #else
+        float val = 1.0f;
+        int n = 0;
+        #if defined(PHASESHIFT_SIMD_X86) && defined(__AVX2__)
+        {
+            __m256 acc = _mm256_set1_ps(1.0f);
+            for (; n+8 <= size; n += 8)
+                acc = _mm256_mul_ps(acc, _mm256_loadu_ps(in+n));
+            val = reduce_mul(acc);
+        }
+        #elif defined(PHASESHIFT_SIMD_NEON)
+        {
+            float32x4_t acc = vdupq_n_f32(1.0f);
+            for (; n+4 <= size; n += 4)
+                acc = vmulq_f32(acc, vld1q_f32(in+n));
+            val = reduce_mul(acc);
+        }
+        #endif
+        for (; n < size; ++n)
+            val *= in[n];
 
         return val;
+        #endif
     }
 
     template<typename T, typename array_type>
@@ -109,11 +398,19 @@ namespace phaseshift {
         if (array.size() == 0)  return static_cast<T>(1);
         if (array.size() == 1)  return array[0];
 
-        T val = static_cast<T>(1);
-        for (int n=1; n < static_cast<int>(array.size()); ++n)
-            val *= array[n];
+        if constexpr (phaseshift::dev::has_contiguous_data<array_type>::value
+                      && std::is_same_v<typename array_type::value_type, float>
+                      && std::is_same_v<T, float>) {
+            return prod(array.data(), static_cast<int>(array.size()));
+        } else {
+            // Accumulate from index 0: the former loop started at 1 and
+            // silently dropped the first element.
+            T val = static_cast<T>(1);
+            for (int n=0; n < static_cast<int>(array.size()); ++n)
+                val *= array[n];
 
-        return val;
+            return val;
+        }
     }
 
     template<typename T>
@@ -129,6 +426,10 @@ namespace phaseshift {
         return mean_sum/size;
     }
 
+    //! Convenience overload for cold paths only: deque iteration pays block
+    //! navigation on every step and cannot vectorize, roughly 3-5x slower
+    //! than the contiguous scan. Hot callers should hold their data in a
+    //! phaseshift::vector and go through the overloads above.
     template<typename T>
     inline T mean(const std::deque<T>& array) {
         assert(array.size() > 0);
@@ -155,19 +456,72 @@ namespace phaseshift {
         return mean_sum/array.size();
     }
 
+    //! Pointer+length core of the standard deviation around a given mean:
+    //! the squared-difference reduction runs 8 lanes per iteration on
+    //! AVX2, reduced across lanes at the end. The (x-mean) form is
+    //! already well-conditioned, so no compensated accumulation is needed.
+    PHASESHIFT_SIGPROC_CORE float std(const float* PHASESHIFT_RESTRICT in, int size, float meanv) {
+        #if defined(PHASESHIFT_SIGPROC_DISPATCH)
+        return sigproc_get().std(in, size, meanv);
+        #else
+        assert(size > 0);
+        if (size == 1)  return 0.0f;
+
+        float var_sum = 0.0f;
+        int n = 0;
+        #if defined(PHASESHIFT_SIMD_X86) && defined(__AVX2__)
+        {
+            const __m256 vmean = _mm256_set1_ps(meanv);
+            __m256 acc = _mm256_setzero_ps();
+            for (; n+8 <= size; n += 8) {
+                __m256 d = _mm256_sub_ps(_mm256_loadu_ps(in+n), vmean);
+                #if defined(__FMA__)
+                    acc = _mm256_fmadd_ps(d, d, acc);
+                #else
+                    acc = _mm256_add_ps(acc, _mm256_mul_ps(d, d));
+                #endif
+            }
+            var_sum = reduce_add(acc);
+        }
+        #elif defined(PHASESHIFT_SIMD_NEON)
+        {
+            const float32x4_t vmean = vdupq_n_f32(meanv);
+            float32x4_t acc = vdupq_n_f32(0.0f);
+            for (; n+4 <= size; n += 4) {
+                float32x4_t d = vsubq_f32(vld1q_f32(in+n), vmean);
+                acc = vmlaq_f32(acc, d, d);
+            }
+            var_sum = reduce_add(acc);
+        }
+        #endif
+        for (; n < size; ++n) {
+            float diff = in[n] - meanv;
+            var_sum += diff * diff;
+        }
+
+        return std::sqrt(var_sum / (size-1));
+        #endif
+    }
+
     template<typename T, typename array_type>
     inline T std(const array_type& array, T meanv) {
         assert(array.size() > 0);
         if (array.size() == 1)  return static_cast<T>(0.0);
 
-        T diff = array[0] - meanv;
-        T var_sum = diff * diff;
-        for (int n=0; n < static_cast<int>(array.size()); ++n) {
-            diff = array[n] - meanv;
-            var_sum += diff * diff;
-        }
+        if constexpr (phaseshift::dev::has_contiguous_data<array_type>::value
+                      && std::is_same_v<typename array_type::value_type, float>
+                      && std::is_same_v<T, float>) {
+            return std(array.data(), static_cast<int>(array.size()), meanv);
+        } else {
+            // Accumulate each element exactly once, starting from index 0.
+            T var_sum = static_cast<T>(0.0);
+            for (int n=0; n < static_cast<int>(array.size()); ++n) {
+                T diff = array[n] - meanv;
+                var_sum += diff * diff;
+            }
 
-        return std::sqrt(var_sum / (array.size()-1));
+            return std::sqrt(var_sum / (array.size()-1));
+        }
     }
     template<typename T, typename array_type>
     inline T std(const array_type& array) {
@@ -177,26 +531,140 @@ namespace phaseshift {
         return std(array, phaseshift::mean<T>(array));
     }
 
+    //! Pointer+length core of norm (sum of squares), 16 lanes per
+    //! iteration on AVX2: two independent accumulators break the
+    //! FMA-latency dependency chain, so the loop runs at load throughput
+    //! instead of accumulate latency.
+    PHASESHIFT_SIGPROC_CORE float norm(const float* PHASESHIFT_RESTRICT in, int size) {
+        #if defined(PHASESHIFT_SIGPROC_DISPATCH)
+        return sigproc_get().norm(in, size);
+        #else
+        float val = 0.0f;
+        int n = 0;
+        #if defined(PHASESHIFT_SIMD_X86) && defined(__AVX2__)
+        {
+            __m256 acc0 = _mm256_setzero_ps();
+            __m256 acc1 = _mm256_setzero_ps();
+            for (; n+16 <= size; n += 16) {
+                __m256 v0 = _mm256_loadu_ps(in+n);
+                __m256 v1 = _mm256_loadu_ps(in+n+8);
+                #if defined(__FMA__)
+                    acc0 = _mm256_fmadd_ps(v0, v0, acc0);
+                    acc1 = _mm256_fmadd_ps(v1, v1, acc1);
+                #else
+                    acc0 = _mm256_add_ps(acc0, _mm256_mul_ps(v0, v0));
+                    acc1 = _mm256_add_ps(acc1, _mm256_mul_ps(v1, v1));
+                #endif
+            }
+            for (; n+8 <= size; n += 8) {
+                __m256 v = _mm256_loadu_ps(in+n);
+                #if defined(__FMA__)
+                    acc0 = _mm256_fmadd_ps(v, v, acc0);
+                #else
+                    acc0 = _mm256_add_ps(acc0, _mm256_mul_ps(v, v));
+                #endif
+            }
+            val = reduce_add(_mm256_add_ps(acc0, acc1));
+        }
+        #elif defined(PHASESHIFT_SIMD_NEON)
+        {
+            // Same dual-accumulator scheme, 8 lanes per iteration.
+            float32x4_t acc0 = vdupq_n_f32(0.0f);
+            float32x4_t acc1 = vdupq_n_f32(0.0f);
+            for (; n+8 <= size; n += 8) {
+                float32x4_t v0 = vld1q_f32(in+n);
+                float32x4_t v1 = vld1q_f32(in+n+4);
+                acc0 = vmlaq_f32(acc0, v0, v0);
+                acc1 = vmlaq_f32(acc1, v1, v1);
+            }
+            for (; n+4 <= size; n += 4) {
+                float32x4_t v = vld1q_f32(in+n);
+                acc0 = vmlaq_f32(acc0, v, v);
+            }
+            val = reduce_add(vaddq_f32(acc0, acc1));
+        }
+        #endif
+        for (; n < size; ++n)
+            val += in[n] * in[n];
+
+        return val;
+        #endif
+    }
+
     template<typename T, typename array_type>
     inline T norm(const array_type& array) {
         assert(array.size() > 0);
 
-        T* pvalue = array.data();
+        if constexpr (phaseshift::dev::has_contiguous_data<array_type>::value
+                      && std::is_same_v<typename array_type::value_type, float>
+                      && std::is_same_v<T, float>) {
+            return norm(array.data(), static_cast<int>(array.size()));
+        } else {
+            T sum = static_cast<T>(0.0);
+            for (int n=0; n < static_cast<int>(array.size()); ++n) {
+                sum += array[n] * array[n];
+            }
 
-        T sum = static_cast<T>(0.0);
-        for (int n=0; n < static_cast<int>(array.size()); ++n) {
-            sum += *pvalue * *pvalue;
-            ++pvalue;
+            return sum;
         }
+    }
 
-        return sum;
+    //! Pointer+length core of the sigmoid fill.
+    PHASESHIFT_SIGPROC_CORE void sigmoid(float* PHASESHIFT_RESTRICT p, int size, float cf, float vc) {
+        #if defined(PHASESHIFT_SIGPROC_DISPATCH)
+        sigproc_get().sigmoid(p, size, cf, vc);
+        #else
+        const float inv_vc = 1.0f/vc;
+        int k = 0;
+        #if defined(PHASESHIFT_SIMD_X86) && defined(__AVX2__)
+            {
+                // 8 lanes per iteration through the polynomial expf (see
+                // simd::exp_ps): one libm exp call per element dominated
+                // this fill.
+                const __m256 vlane = _mm256_setr_ps(0.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f);
+                const __m256 vcf = _mm256_set1_ps(cf);
+                const __m256 vinv_vc = _mm256_set1_ps(inv_vc);
+                const __m256 one = _mm256_set1_ps(1.0f);
+                for (; k+8 <= size; k += 8) {
+                    __m256 vk = _mm256_add_ps(_mm256_set1_ps(static_cast<float>(k)), vlane);
+                    __m256 x = _mm256_mul_ps(_mm256_sub_ps(vcf, vk), vinv_vc);  // -(k-cf)/vc
+                    __m256 e = phaseshift::simd::exp_ps(x);
+                    _mm256_storeu_ps(p+k, _mm256_div_ps(one, _mm256_add_ps(one, e)));
+                }
+            }
+            #elif defined(PHASESHIFT_SIMD_NEON) && defined(__aarch64__)
+            {
+                // 4-lane counterpart through the NEON exp_ps (AArch64:
+                // both the rounded reduction and vdivq need it).
+                const float lane_init[4] = {0.0f, 1.0f, 2.0f, 3.0f};
+                const float32x4_t vlane = vld1q_f32(lane_init);
+                const float32x4_t vcf = vdupq_n_f32(cf);
+                const float32x4_t vinv_vc = vdupq_n_f32(inv_vc);
+                const float32x4_t one = vdupq_n_f32(1.0f);
+                for (; k+4 <= size; k += 4) {
+                    float32x4_t vk = vaddq_f32(vdupq_n_f32(static_cast<float>(k)), vlane);
+                    float32x4_t x = vmulq_f32(vsubq_f32(vcf, vk), vinv_vc);  // -(k-cf)/vc
+                    float32x4_t e = phaseshift::simd::exp_ps(x);
+                    vst1q_f32(p+k, vdivq_f32(one, vaddq_f32(one, e)));
+                }
+            }
+        #endif
+        for (; k < size; ++k) {
+            p[k] = 1.0f/(1.0f+std::exp(-(k-cf)*inv_vc));
+        }
+        #endif
     }
 
     //! Sigmoid transition
     template<typename array_t>
     inline void sigmoid(array_t* parray, float cf, float vc) {
-        for (int k=0; k < parray->size(); ++k) {
-            (*parray)[k] = 1.0f/(1.0f+std::exp(-(k-cf)/vc));
+        if constexpr (phaseshift::dev::has_contiguous_data<array_t>::value
+                      && std::is_same_v<typename array_t::value_type, float>) {
+            sigmoid(parray->data(), static_cast<int>(parray->size()), cf, vc);
+        } else {
+            for (int k=0; k < parray->size(); ++k) {
+                (*parray)[k] = 1.0f/(1.0f+std::exp(-(k-cf)/vc));
+            }
         }
     }
 
@@ -210,7 +678,33 @@ namespace phaseshift {
             ++kcut;
 
         float slope = slope_dbhz*fs/dftlen;
-        for (int k=kcut; k < dftlen/2+1; ++k) {
+        int k = kcut;
+        if constexpr (phaseshift::dev::has_contiguous_data<array_type>::value
+                      && std::is_same_v<typename array_type::value_type, std::complex<float>>) {
+            #if defined(PHASESHIFT_SIMD_X86) && defined(__AVX2__)
+            {
+                // 4 complex bins per iteration: the dB ramp goes through the
+                // polynomial expf (10^(db/20) = exp(db*ln(10)/20)) with each
+                // gain broadcast to its re/im pair, where the per-bin table
+                // lookup chained a latency-bound load per bin. The clamp
+                // reproduces the [-300,0] domain of the db2lin01 table.
+                const int kend = dftlen/2+1;
+                float* p = reinterpret_cast<float*>(parray->data());
+                const __m256 vslope = _mm256_set1_ps(slope);
+                const __m256 vpair = _mm256_setr_ps(0.0f, 0.0f, 1.0f, 1.0f, 2.0f, 2.0f, 3.0f, 3.0f);
+                const __m256 vln10_20 = _mm256_set1_ps(0.11512925464970229f);
+                const __m256 vdbmin = _mm256_set1_ps(-300.0f);
+                const __m256 vzero = _mm256_setzero_ps();
+                for (; k+4 <= kend; k += 4) {
+                    __m256 kv = _mm256_add_ps(_mm256_set1_ps(static_cast<float>(k-kcut)), vpair);
+                    __m256 db = _mm256_max_ps(_mm256_min_ps(_mm256_mul_ps(vslope, kv), vzero), vdbmin);
+                    __m256 gain = phaseshift::simd::exp_ps(_mm256_mul_ps(db, vln10_20));
+                    _mm256_storeu_ps(p+2*k, _mm256_mul_ps(_mm256_loadu_ps(p+2*k), gain));
+                }
+            }
+            #endif
+        }
+        for (; k < dftlen/2+1; ++k) {
             (*parray)[k] *= phaseshift::db2lin01_ltf(slope*(k-kcut));
         }
     }
@@ -220,8 +714,17 @@ namespace phaseshift {
     template<class array_type>
     inline void shift_half_size(array_type* parray) {
         array_type& array = *parray;
-        for (int k=0; k < static_cast<int>(array.size())/2; ++k) {
-            std::swap(array[k], array[(k+array.size()/2)%array.size()]);
+        const int half = static_cast<int>(array.size())/2;
+        if constexpr (phaseshift::dev::has_contiguous_data<array_type>::value) {
+            // Two contiguous runs: swap_ranges compiles to wide block
+            // moves, where the former element loop carried a modulo (which
+            // was always the identity: k+half never wraps) and an
+            // element-sized swap per iteration.
+            std::swap_ranges(array.data(), array.data()+half, array.data()+half);
+        } else {
+            for (int k=0; k < half; ++k) {
+                std::swap(array[k], array[k+half]);
+            }
         }
     }
 
@@ -231,19 +734,109 @@ namespace phaseshift {
         if (delay == 0)
             return;
 
-        if ((-delay) < 0) {
-            for (int n=parray->size()-1; n >= delay; --n) {
-                (*parray)[n] = (*parray)[n-delay];
-            }
-            std::memset(parray->data(), 0, sizeof(float)*delay);
+        // Pure data motion: one memmove (overlap-safe) plus one memset
+        // instead of the former per-element copy loops, so libc's
+        // bandwidth-tuned kernels do the work. A shift of the whole
+        // buffer or more just clears it.
+        float* data = parray->data();
+        const int size = parray->size();
+        if (delay > 0) {
+            const int m = std::min(delay, size);
+            std::memmove(data + m, data, sizeof(float)*(size - m));
+            std::memset(data, 0, sizeof(float)*m);
         } else {
-            for (int n=0; n < parray->size() - (-delay); ++n) {
-                (*parray)[n] = (*parray)[n+(-delay)];
-            }
-            std::memset(parray->data()+(parray->size() - (-delay)), 0, sizeof(float)*(-delay));
+            const int m = std::min(-delay, size);
+            std::memmove(data, data + m, sizeof(float)*(size - m));
+            std::memset(data + (size - m), 0, sizeof(float)*m);
         }
     }
 
+    //! Pointer+length core of the spectrum rotation: `pdst0` points at the
+    //! interleaved re/im data of `size` complex bins, `phase_shift_coef` is
+    //! the per-bin phase increment in radians.
+    PHASESHIFT_SIGPROC_CORE void timeshift_hspec(float* PHASESHIFT_RESTRICT pdst0, int size, float phase_shift_coef) {
+        #if defined(PHASESHIFT_SIGPROC_DISPATCH)
+            sigproc_get().timeshift_hspec(pdst0, size, phase_shift_coef);
+        #else
+            const float phase_shift_coef_idxf = phase_shift_coef*g_lt_cos_x2i;
+            const float twopi_idxf = phaseshift::twopi*g_lt_cos_x2i;
+            const float inv_twopi_idxf = 1.0f/twopi_idxf;
+            int k = 0;
+            #if defined(PHASESHIFT_SIMD_X86) && defined(__AVX2__)
+            {
+                // 8 complex bins per iteration. The phases come straight
+                // from k (signed coefficient: the floor wrap brings
+                // negative shifts into [0,2pi), which makes the sin sign
+                // come out right without a separate branch), and one
+                // gather on the interleaved Q15 table fetches the 8
+                // [cos,sin] pairs, same as cos_sin_ltf_vec. The bins are
+                // deinterleaved into re/im vectors for the rotation and
+                // interleaved back for the store.
+                const __m256 vcoef = _mm256_set1_ps(phase_shift_coef_idxf);
+                const __m256 vlane = _mm256_setr_ps(0.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f);
+                const __m256 vhalf = _mm256_set1_ps(0.5f);  // +0.5 for rounding to nearest neighbor
+                const __m256 vtwopi = _mm256_set1_ps(twopi_idxf);
+                const __m256 vinvtwopi = _mm256_set1_ps(inv_twopi_idxf);
+                const __m256i idxmask = _mm256_set1_epi32(g_lt_cos_mask);
+                const __m256 q15scale = _mm256_set1_ps(1.0f/32767.0f);
+                const int* cos_sin_q15 = reinterpret_cast<const int*>(g_lt_cos_sin_q15_values);
+                for (; k+8 <= size; k += 8) {
+                    __m256 ph = _mm256_add_ps(_mm256_mul_ps(_mm256_add_ps(_mm256_set1_ps(static_cast<float>(k)), vlane), vcoef), vhalf);
+                    ph = _mm256_sub_ps(ph, _mm256_mul_ps(vtwopi, _mm256_floor_ps(_mm256_mul_ps(ph, vinvtwopi))));
+                    __m256i idx = _mm256_and_si256(_mm256_cvttps_epi32(ph), idxmask);
+                    __m256i pair = _mm256_i32gather_epi32(cos_sin_q15, idx, 4);
+                    __m256 c = _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_srai_epi32(_mm256_slli_epi32(pair, 16), 16)), q15scale);
+                    __m256 d = _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_srai_epi32(pair, 16)), q15scale);
+                    float* p = pdst0 + 2*k;
+                    __m256 lo = _mm256_loadu_ps(p);
+                    __m256 hi = _mm256_loadu_ps(p+8);
+                    __m256 t0 = _mm256_permute2f128_ps(lo, hi, 0x20);
+                    __m256 t1 = _mm256_permute2f128_ps(lo, hi, 0x31);
+                    __m256 a = _mm256_shuffle_ps(t0, t1, _MM_SHUFFLE(2, 0, 2, 0));
+                    __m256 b = _mm256_shuffle_ps(t0, t1, _MM_SHUFFLE(3, 1, 3, 1));
+                    __m256 re = _mm256_sub_ps(_mm256_mul_ps(a, c), _mm256_mul_ps(b, d));
+                    __m256 im = _mm256_add_ps(_mm256_mul_ps(a, d), _mm256_mul_ps(b, c));
+                    __m256 u0 = _mm256_unpacklo_ps(re, im);
+                    __m256 u1 = _mm256_unpackhi_ps(re, im);
+                    _mm256_storeu_ps(p,   _mm256_permute2f128_ps(u0, u1, 0x20));
+                    _mm256_storeu_ps(p+8, _mm256_permute2f128_ps(u0, u1, 0x31));
+                }
+            }
+            #endif
+            float* pdst = pdst0 + 2*k;
+            float a, b, c, d, phiidxf, x, y, z;
+            int cossinidx;
+            // The phase index is recomputed from k every iteration instead
+            // of accumulated, and wrapped with one floor instead of a
+            // data-dependent while whose trip count grows with the bin
+            // index: no loop-carried dependency, no unpredictable branch.
+            // The signed coefficient goes straight through the floor wrap
+            // (like the vector body), which folds the former duplicated
+            // positive/negative loops into one: the wrapped angle lands in
+            // [0,2pi) with the sin sign already right.
+            // cos and sin come from the interleaved Q15 table the vector
+            // body gathers from: one 32-bit load per bin and one cache
+            // line per 16 pairs, where the float table needed two loads a
+            // quarter period apart (two lines touched per bin).
+            for (; k < size; ++k) {
+
+                phiidxf = k*phase_shift_coef_idxf + 0.5f;  // +0.5 for rounding to nearest neighbor
+                phiidxf -= twopi_idxf * std::floor(phiidxf * inv_twopi_idxf);
+                cossinidx = static_cast<int>(phiidxf) & g_lt_cos_mask;
+                c = g_lt_cos_sin_q15_values[2*cossinidx] * (1.0f/32767.0f);
+                d = g_lt_cos_sin_q15_values[2*cossinidx+1] * (1.0f/32767.0f);
+
+                a = *pdst;
+                b = *(pdst+1);
+                x = a * (c - d);
+                y = a + b;
+                z = a - b;
+                *pdst++ = z * d + x;
+                *pdst++ = y * c - x;
+            }
+        #endif
+    }
+
     //! nbsamplef : Number of sample to shift the signal. Can be non-integer.
     template<class array_type>
     inline void timeshift_hspec(array_type* parray, float nbsamplef) {
@@ -252,54 +845,7 @@ namespace phaseshift {
         float phase_shift_coef = nbsamplef * two_pi / static_cast<float>(dftlen);
 
         #if 1
-            float phase_shift_coef_idxf = phase_shift_coef*g_lt_cos_x2i;
-            float twopi_idxf = phaseshift::twopi*g_lt_cos_x2i;
-            float* pdst = reinterpret_cast<float*>(parray->data());
-            int size = parray->size();
-            float a, b, c, d, phiidxf, x, y, z;
-            int cossinidx;
-            phiidxf = 0.5f;  // +0.5 for rounding to nearest neighbor
-            if (phase_shift_coef > 0) {
-                for (int k = 0; k < size; ++k) {
-
-                    while (phiidxf > twopi_idxf)
-                        phiidxf -= twopi_idxf;
-                    cossinidx = static_cast<int>(phiidxf);
-                    c = g_lt_cos_values[cossinidx];
-                    d = g_lt_sin_values[cossinidx];
-
-                    a = *pdst;
-                    b = *(pdst+1);
-                    x = a * (c - d);
-                    y = a + b;
-                    z = a - b;
-                    *pdst++ = z * d + x;
-                    *pdst++ = y * c - x;
-
-                    phiidxf += phase_shift_coef_idxf;
-                }
-            } else {
-                phase_shift_coef_idxf = -phase_shift_coef_idxf;
-                for (int k = 0; k < size; ++k) {
-
-                    while (phiidxf > twopi_idxf)
-                        phiidxf -= twopi_idxf;
-                    cossinidx = static_cast<int>(phiidxf);
-                    c = g_lt_cos_values[cossinidx];
-                    d = g_lt_sin_values[cossinidx];
-                    // d = -d;  // The only diff from the positive version above (merged in eqs. below)
-
-                    a = *pdst;
-                    b = *(pdst+1);
-                    x = a * (c + d);
-                    y = a + b;
-                    z = a - b;
-                    *pdst++ = x - z * d;
-                    *pdst++ = y * c - x;
-
-                    phiidxf += phase_shift_coef_idxf;
-                }
-            }
+            timeshift_hspec(reinterpret_cast<float*>(parray->data()), static_cast<int>(parray->size()), phase_shift_coef);
         #elif 0
             float phi = 0.0f;
             float* pdst = reinterpret_cast<float*>(parray->data());
@@ -0,0 +1,61 @@
+// Copyright (C) 2025 Gilles Degottex <gilles.degottex@gmail.com> All Rights Reserved.
+//
+// You may use, distribute and modify this code under the
+// terms of the Apache 2.0 license.
+// If you don't have a copy of this license, please visit:
+//     https://github.com/gillesdegottex/phaseshift
+
+// Baseline-ISA kernel table and runtime selection for the sigproc cores.
+// PHASESHIFT_SIGPROC_KERNELS_TU makes sigproc.h expose the raw kernel bodies
+// with internal linkage, so this table holds copies compiled at the build
+// baseline and cannot be merged with the AVX2 instances by the linker.
+
+#define PHASESHIFT_SIGPROC_KERNELS_TU
+#include <phaseshift/sigproc/sigproc.h>
+#include <phaseshift/sigproc/sigproc_dispatch.h>
+
+#include <mutex>
+
+namespace {
+
+    const phaseshift::sigproc_ops g_sigproc_ops_scalar = {
+        phaseshift::argmin,
+        phaseshift::argmax,
+        phaseshift::sum,
+        phaseshift::prod,
+        phaseshift::norm,
+        phaseshift::std,
+        phaseshift::sigmoid,
+        phaseshift::timeshift_hspec,
+        "scalar",
+    };
+
+}  // namespace
+
+// ISA-specific tables, each defined in its own translation unit which is
+// compiled with the matching -m flags (see CMakeLists.txt).
+namespace phaseshift {
+    namespace detail {
+        #ifdef PHASESHIFT_SIGPROC_AVX2
+        extern const sigproc_ops g_sigproc_ops_avx2;
+        #endif
+    }  // namespace detail
+}  // namespace phaseshift
+
+const phaseshift::sigproc_ops& phaseshift::sigproc_get() {
+    static const phaseshift::sigproc_ops* selected = nullptr;
+    static std::once_flag selected_once;
+
+    std::call_once(selected_once, []() {
+        selected = &g_sigproc_ops_scalar;
+
+        #ifdef PHASESHIFT_SIGPROC_AVX2
+        #if defined(__GNUC__) || defined(__clang__)
+        if (__builtin_cpu_supports("avx2"))
+            selected = &phaseshift::detail::g_sigproc_ops_avx2;
+        #endif
+        #endif
+    });
+
+    return *selected;
+}
@@ -0,0 +1,42 @@
+// Copyright (C) 2025 Gilles Degottex <gilles.degottex@gmail.com> All Rights Reserved.
+//
+// You may use, distribute and modify this code under the
+// terms of the Apache 2.0 license.
+// If you don't have a copy of this license, please visit:
+//     https://github.com/gillesdegottex/phaseshift
+//
+// Runtime CPU dispatch of the hot sigproc kernels.
+// The dispatch follows the audio_block/wav_convert pattern: one table of
+// kernel pointers per ISA, the best one being selected once from the cpu
+// flags. The inline entry points in sigproc.h route through the table only
+// when the build baseline is below AVX2, so a baseline that already carries
+// AVX2 keeps the direct inline path.
+
+#ifndef PHASESHIFT_SIGPROC_SIGPROC_DISPATCH_H_
+#define PHASESHIFT_SIGPROC_SIGPROC_DISPATCH_H_
+
+namespace phaseshift {
+
+    //! Kernel table for the contiguous-float sigproc cores.
+    struct sigproc_ops {
+        int (*argmin)(const float* in, int size);
+        int (*argmax)(const float* in, int size);
+        float (*sum)(const float* in, int size);
+        float (*prod)(const float* in, int size);
+        float (*norm)(const float* in, int size);
+        float (*std)(const float* in, int size, float meanv);
+        void (*sigmoid)(float* p, int size, float cf, float vc);
+        //! `bins` points at interleaved re/im data of `size` complex bins
+        void (*timeshift_hspec)(float* bins, int size, float phase_shift_coef);
+
+        //! Name of the ISA the kernels are compiled for (ex. "scalar", "avx2")
+        const char* name;
+    };
+
+    //! Return the kernel table matching the running CPU.
+    //  The selection is done once (thread-safe), subsequent calls are a single load.
+    const sigproc_ops& sigproc_get();
+
+}  // namespace phaseshift
+
+#endif  // PHASESHIFT_SIGPROC_SIGPROC_DISPATCH_H_
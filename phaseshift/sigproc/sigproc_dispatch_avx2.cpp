@@ -0,0 +1,41 @@
+// Copyright (C) 2025 Gilles Degottex <gilles.degottex@gmail.com> All Rights Reserved.
+//
+// You may use, distribute and modify this code under the
+// terms of the Apache 2.0 license.
+// If you don't have a copy of this license, please visit:
+//     https://github.com/gillesdegottex/phaseshift
+//
+// AVX2 table for the sigproc kernels. This translation unit is compiled with
+// -mavx2 -mfma (see CMakeLists.txt): including sigproc.h under these flags
+// instantiates the very same inline kernels as everywhere else, just with
+// their AVX2 bodies enabled, so nothing is written twice. The kernels must
+// be entered only after __builtin_cpu_supports("avx2") returned true.
+
+#ifdef PHASESHIFT_SIGPROC_AVX2
+
+#define PHASESHIFT_SIGPROC_KERNELS_TU
+#include <phaseshift/sigproc/sigproc.h>
+#include <phaseshift/sigproc/sigproc_dispatch.h>
+
+namespace phaseshift {
+    namespace detail {
+
+        // extern: a const object at namespace scope is internal by default,
+        // and the selection in sigproc_dispatch.cpp must find this one.
+        extern const sigproc_ops g_sigproc_ops_avx2;
+        const sigproc_ops g_sigproc_ops_avx2 = {
+            phaseshift::argmin,
+            phaseshift::argmax,
+            phaseshift::sum,
+            phaseshift::prod,
+            phaseshift::norm,
+            phaseshift::std,
+            phaseshift::sigmoid,
+            phaseshift::timeshift_hspec,
+            "avx2",
+        };
+
+    }  // namespace detail
+}  // namespace phaseshift
+
+#endif  // PHASESHIFT_SIGPROC_AVX2
@@ -12,6 +12,7 @@
 
 #include <cmath>
 #include <complex>
+#include <cstdint>
 #include <deque>
 #include <vector>
 
@@ -45,6 +46,65 @@ TEST_CASE("sigproc_basic_stats", "[sigproc]") {
     REQUIRE(std::abs(phaseshift::norm<float>(norm_values) - 25.0f) < 1e-6f);
 }
 
+TEST_CASE("sigproc_argminmax_simd", "[sigproc]") {
+    // Sizes >= 16 run the vectorized argmin/argmax cores; 100 is not a
+    // multiple of 8, so the scalar tail runs too.
+    const int size = 100;
+    std::vector<float> values(size);
+
+    // Deterministic pseudo-random fill, checked against a scalar scan.
+    uint32_t state = 123456789u;
+    for (int n = 0; n < size; ++n) {
+        state = 1664525u*state + 1013904223u;
+        values[n] = static_cast<float>(state % 20000u) / 10000.0f - 1.0f;
+    }
+    int ref_min = 0;
+    int ref_max = 0;
+    for (int n = 1; n < size; ++n) {
+        if (values[n] < values[ref_min])  ref_min = n;
+        if (values[n] > values[ref_max])  ref_max = n;
+    }
+    REQUIRE(phaseshift::argmin<float>(values) == ref_min);
+    REQUIRE(phaseshift::argmax<float>(values) == ref_max);
+
+    // Duplicated extrema in different lanes (13%8 != 45%8): ties resolve
+    // to the first occurrence, like the scalar scan.
+    for (int n = 0; n < size; ++n) {
+        values[n] = 0.0f;
+    }
+    values[13] = -2.0f;
+    values[45] = -2.0f;
+    values[21] = 2.0f;
+    values[60] = 2.0f;
+    REQUIRE(phaseshift::argmin<float>(values) == 13);
+    REQUIRE(phaseshift::argmax<float>(values) == 21);
+
+    // Same lane (19%8 == 83%8), racing within one register.
+    values[45] = 0.0f;
+    values[60] = 0.0f;
+    values[13] = 0.0f;
+    values[21] = 0.0f;
+    values[19] = -2.0f;
+    values[83] = -2.0f;
+    REQUIRE(phaseshift::argmin<float>(values) == 19);
+
+    // Extremum in the scalar tail (96..99 with size 100).
+    values[19] = 0.0f;
+    values[83] = 0.0f;
+    values[99] = -2.0f;
+    values[97] = 2.0f;
+    REQUIRE(phaseshift::argmin<float>(values) == 99);
+    REQUIRE(phaseshift::argmax<float>(values) == 97);
+
+    // Extremum in the very first vector.
+    values[99] = 0.0f;
+    values[97] = 0.0f;
+    values[0] = -2.0f;
+    values[7] = 2.0f;
+    REQUIRE(phaseshift::argmin<float>(values) == 0);
+    REQUIRE(phaseshift::argmax<float>(values) == 7);
+}
+
 TEST_CASE("sigproc_sigmoid", "[sigproc]") {
     phaseshift::vector<float> values;
     values.resize_allocation(9);
@@ -122,6 +182,52 @@ TEST_CASE("sigproc_timeshift_hspec", "[sigproc]") {
     REQUIRE(std::abs(std::abs(spec[1]) - 1.0f) < 1e-3f);
 }
 
+TEST_CASE("sigproc_timeshift_hspec_long", "[sigproc]") {
+    // hsize 33 >= 8: the vectorized 8-bins-per-iteration body runs for
+    // bins 0..23 and the scalar tail finishes 24..32. Checked against a
+    // double precision rotation; the tolerance is set by the phase
+    // quantization of the 1024-entry cos/sin table (~2pi/1024 rad, i.e.
+    // a few 1e-3 per component at unit magnitude), which dwarfs the Q15
+    // value quantization.
+    const int dftlen = 64;
+    const int hsize = dftlen / 2 + 1;
+    const float nbsamplef = 2.7f;
+
+    phaseshift::vector<std::complex<float>> spec;
+    spec.resize_allocation(hsize);
+    spec.resize(hsize);
+    uint32_t state = 362436069u;
+    for (int k = 0; k < hsize; ++k) {
+        state = 1664525u*state + 1013904223u;
+        const float re = static_cast<float>(state % 20000u) / 10000.0f - 1.0f;
+        state = 1664525u*state + 1013904223u;
+        const float im = static_cast<float>(state % 20000u) / 10000.0f - 1.0f;
+        spec[k] = std::complex<float>(re, im);
+    }
+
+    std::vector<std::complex<double>> ref(hsize);
+    const double coef = nbsamplef * 2.0 * M_PI / dftlen;
+    for (int k = 0; k < hsize; ++k) {
+        const std::complex<double> rot(std::cos(k*coef), std::sin(k*coef));
+        ref[k] = std::complex<double>(spec[k].real(), spec[k].imag()) * rot;
+    }
+
+    phaseshift::timeshift_hspec(&spec, nbsamplef);
+    for (int k = 0; k < hsize; ++k) {
+        REQUIRE(std::abs(spec[k].real() - ref[k].real()) < 5e-3f);
+        REQUIRE(std::abs(spec[k].imag() - ref[k].imag()) < 5e-3f);
+    }
+
+    // A negative shift must be the inverse rotation: shifting back must
+    // recover the input within the same quantization budget.
+    phaseshift::timeshift_hspec(&spec, -nbsamplef);
+    for (int k = 0; k < hsize; ++k) {
+        const std::complex<double> orig = ref[k] * std::complex<double>(std::cos(-k*coef), std::sin(-k*coef));
+        REQUIRE(std::abs(spec[k].real() - orig.real()) < 1e-2f);
+        REQUIRE(std::abs(spec[k].imag() - orig.imag()) < 1e-2f);
+    }
+}
+
 TEST_CASE("sigproc_lowpass_hspec", "[sigproc]") {
     const int dftlen = 16;
     const int hsize = dftlen / 2 + 1;
@@ -10,37 +10,233 @@
 
 #include <phaseshift/utils.h>
 #include <phaseshift/containers/vector.h>
+#include <phaseshift/containers/utils.h>
+#include <phaseshift/simd.h>
 
+#include <array>
 #include <cmath>
+#include <cstdint>
+#include <type_traits>
+#include <unordered_map>
 
 namespace phaseshift {
 
+    namespace detail {
+
+        enum win_kind : uint64_t {
+            win_kind_hamming = 1,
+            win_kind_hann,
+            win_kind_blackman,
+            win_kind_gaussian,
+            win_kind_kaiser,
+        };
+
+        struct win_cache_entry {
+            float extra;  // sigma or alpha; 0 for the parameterless windows
+            phaseshift::vector<float> win;
+        };
+
+        //! Per-thread cache of generated float windows. STFT pipelines ask
+        //! for the same few (kind, N) pairs over and over; after the first
+        //! call the whole generation collapses into a lookup and a copy.
+        //! thread_local, so no lock ever lands on an audio path.
+        inline std::unordered_map<uint64_t, win_cache_entry>& win_cache() {
+            thread_local std::unordered_map<uint64_t, win_cache_entry> cache;
+            return cache;
+        }
+
+        //! Bound on the live entries per thread; a handful of sizes covers
+        //! any realistic pipeline.
+        static constexpr size_t win_cache_entries_max = 16;
+
+        //! kind and norm_sum in the low bits, N above: injective for any
+        //! realistic N. The float parameter of Gaussian/Kaiser is compared
+        //! on the stored entry instead of widening the key, so a parameter
+        //! sweep overwrites one slot instead of growing the map.
+        inline uint64_t win_cache_key(win_kind kind, int N, bool norm_sum) {
+            return (uint64_t(N) << 4) | (uint64_t(kind) << 1) | uint64_t(norm_sum);
+        }
+
+        //! Serve *pwin from the cache, or run gen() (which fills *pwin) and
+        //! remember the result.
+        template<typename generator_type>
+        inline void win_cache_fill(win_kind kind, int N, bool norm_sum, float extra,
+                                   phaseshift::vector<float>* pwin, generator_type gen) {
+            auto& cache = win_cache();
+            const uint64_t key = win_cache_key(kind, N, norm_sum);
+            auto it = cache.find(key);
+            if (it != cache.end() && it->second.extra == extra) {
+                // vector assignment, not simd::copy_aligned: *pwin may be a
+                // borrowed view (ndarray2vector_view) whose base has neither
+                // the allocation alignment nor the tail slack.
+                *pwin = it->second.win;
+                return;
+            }
+            gen();
+            if (it == cache.end() && cache.size() >= win_cache_entries_max)
+                cache.clear();  // full reset over LRU bookkeeping: the live set is tiny
+            win_cache_entry& e = cache[key];
+            e.extra = extra;
+            e.win.resize_allocation(N);
+            e.win = *pwin;
+        }
+
+    }  // namespace detail
+
+    #if defined(PHASESHIFT_SIMD_X86) && defined(__AVX2__)
+    namespace detail {
+        //! Fill win[0,H) with a0 - (1-a0)*cos(2*pi*n/(N-1)), 8 samples per
+        //! iteration through the polynomial cos; covers Hamming and Hann,
+        //! which differ only by a0. Accumulates the sum of the produced
+        //! samples in double lanes alongside the stores (float lanes would
+        //! bias the normalization of long windows) and adds it to *psum;
+        //! returns the first index the scalar tail still has to produce.
+        inline int win_raised_cos_avx2(float* win, int N, int H, float a0, double* psum) {
+            const __m256 vstep = _mm256_set1_ps(static_cast<float>(2*M_PI/(N-1)));
+            const __m256 vbase = _mm256_setr_ps(0, 1, 2, 3, 4, 5, 6, 7);
+            const __m256 va0 = _mm256_set1_ps(a0);
+            const __m256 vma = _mm256_set1_ps(-(1.0f-a0));
+            __m256d vsum0 = _mm256_setzero_pd();
+            __m256d vsum1 = _mm256_setzero_pd();
+            int n = 0;
+            for (; n+8 <= H; n += 8) {
+                __m256 phase = _mm256_mul_ps(_mm256_add_ps(vbase, _mm256_set1_ps(static_cast<float>(n))), vstep);
+                __m256 w = _mm256_add_ps(va0, _mm256_mul_ps(vma, simd::cos_ps(phase)));
+                _mm256_storeu_ps(win+n, w);
+                vsum0 = _mm256_add_pd(vsum0, _mm256_cvtps_pd(_mm256_castps256_ps128(w)));
+                vsum1 = _mm256_add_pd(vsum1, _mm256_cvtps_pd(_mm256_extractf128_ps(w, 1)));
+            }
+            const __m256d vs = _mm256_add_pd(vsum0, vsum1);
+            __m128d s = _mm_add_pd(_mm256_castpd256_pd128(vs), _mm256_extractf128_pd(vs, 1));
+            *psum += _mm_cvtsd_f64(_mm_add_sd(s, _mm_unpackhi_pd(s, s)));
+            return n;
+        }
+
+        //! Bessel I0 over 8 lanes: both branches of the piecewise
+        //! approximation (see modified_bessel_firstkind_zeroorder below) are
+        //! evaluated and blended on the 3.75 split, which keeps the loop
+        //! branchless; the exp comes from simd::exp_ps.
+        inline __m256 bessel_i0_ps(__m256 x) {
+            const __m256 split = _mm256_set1_ps(3.75f);
+            const __m256 one = _mm256_set1_ps(1.0f);
+
+            __m256 ax = _mm256_and_ps(x, _mm256_castsi256_ps(_mm256_set1_epi32(0x7fffffff)));
+
+            // ax < 3.75: polynomial in (ax/3.75)^2
+            __m256 t = _mm256_mul_ps(ax, _mm256_set1_ps(1.0f/3.75f));
+            t = _mm256_mul_ps(t, t);
+            __m256 ps = _mm256_set1_ps(0.0045813f);
+            ps = _mm256_add_ps(_mm256_mul_ps(ps, t), _mm256_set1_ps(0.0360768f));
+            ps = _mm256_add_ps(_mm256_mul_ps(ps, t), _mm256_set1_ps(0.2659732f));
+            ps = _mm256_add_ps(_mm256_mul_ps(ps, t), _mm256_set1_ps(1.2067492f));
+            ps = _mm256_add_ps(_mm256_mul_ps(ps, t), _mm256_set1_ps(3.0899424f));
+            ps = _mm256_add_ps(_mm256_mul_ps(ps, t), _mm256_set1_ps(3.5156229f));
+            ps = _mm256_add_ps(_mm256_mul_ps(ps, t), one);
+
+            // ax >= 3.75: exp(ax)/sqrt(ax) * polynomial in 3.75/ax. The
+            // divider only runs on the blended result path, not per term.
+            __m256 y = _mm256_div_ps(split, _mm256_max_ps(ax, split));
+            __m256 pl = _mm256_set1_ps(0.00392377f);
+            pl = _mm256_add_ps(_mm256_mul_ps(pl, y), _mm256_set1_ps(-0.01647633f));
+            pl = _mm256_add_ps(_mm256_mul_ps(pl, y), _mm256_set1_ps(0.02635537f));
+            pl = _mm256_add_ps(_mm256_mul_ps(pl, y), _mm256_set1_ps(-0.02057706f));
+            pl = _mm256_add_ps(_mm256_mul_ps(pl, y), _mm256_set1_ps(0.00916281f));
+            pl = _mm256_add_ps(_mm256_mul_ps(pl, y), _mm256_set1_ps(-0.00157565f));
+            pl = _mm256_add_ps(_mm256_mul_ps(pl, y), _mm256_set1_ps(0.00225319f));
+            pl = _mm256_add_ps(_mm256_mul_ps(pl, y), _mm256_set1_ps(0.01328592f));
+            pl = _mm256_add_ps(_mm256_mul_ps(pl, y), _mm256_set1_ps(0.39894228f));
+            pl = _mm256_mul_ps(pl, _mm256_div_ps(simd::exp_ps(ax), _mm256_sqrt_ps(_mm256_max_ps(ax, split))));
+
+            return _mm256_blendv_ps(pl, ps, _mm256_cmp_ps(ax, split, _CMP_LT_OQ));
+        }
+    }  // namespace detail
+    #endif
+
     // Hamming window ----------------------------------------------------------
+
+    // The point evaluators are per-sample callees of downstream loops:
+    // force-inline them and relax FP semantics locally so the compiler can
+    // contract a0 - (1-a0)*cos(.) into an FMA. Window values do not need
+    // IEEE-strict rounding. (clang ignores the optimize pragma, hence the
+    // guard.)
+    #if defined(__GNUC__) && !defined(__clang__)
+        #pragma GCC push_options
+        #pragma GCC optimize("fast-math,tree-vectorize")
+    #endif
     template<typename value_type>
-    value_type win_hamming_function(value_type nf, int N, bool center_at_zero=true) {
+    PHASESHIFT_HOT PHASESHIFT_ALWAYS_INLINE value_type win_hamming_function(value_type nf, int N, bool center_at_zero=true) {
 
-        float a0 = 25.0f/46.0f;
+        static constexpr float a0 = 25.0f/46.0f;
 
         if (center_at_zero)
             nf += static_cast<float>(N-1)/2;
 
-        return a0 - (1.0f-a0)*std::cos(static_cast<value_type>(2*M_PI*nf/(N-1)));
+        // Keep the argument in value_type: for float this selects cosf and
+        // avoids the double promotion that M_PI would otherwise force.
+        return a0 - (1.0f-a0)*std::cos(static_cast<value_type>(2*M_PI)*nf/static_cast<value_type>(N-1));
     }
+    #if defined(__GNUC__) && !defined(__clang__)
+        #pragma GCC pop_options
+    #endif
 
     template<typename value_type>
     void win_hamming(value_type* win, int N, bool norm_sum=true) {
 
-        float a0 = 25.0f/46.0f;
-
-        float win_sum = 0.0f;
-        for (int n = 0; n < N; ++n) {
-            win[n] = a0 - (1.0f-a0)*std::cos(static_cast<value_type>(2*M_PI*n/(N-1)));
-            win_sum += win[n];
+        static constexpr float a0 = 25.0f/46.0f;
+
+        // The window is symmetric around (N-1)/2: only the first half is
+        // evaluated, the second half is mirrored from it below.
+        const int H = (N+1)/2;
+
+        double win_sum = 0.0;  // double: N float roundings would bias the normalization
+        int n = 0;
+        // The generation is compute-bound on the cosine call, so the float
+        // instantiation evaluates 8 of them per iteration.
+        #if defined(PHASESHIFT_SIMD_X86) && defined(__AVX2__)
+            if constexpr (std::is_same<value_type, float>::value)
+                n = detail::win_raised_cos_avx2(win, N, H, a0, &win_sum);
+        #endif
+        // Remaining samples through the Chebyshev two-term recurrence
+        // cos((n+1)d) = 2cos(d)*cos(nd) - cos((n-1)d): one multiply and one
+        // subtract per sample instead of a libm call. The recurrence runs in
+        // double and reseeds periodically so the drift stays below float
+        // resolution for any N.
+        if (n < H) {
+            static constexpr float a1 = 1.0f - a0;
+            const double delta = 2*M_PI/(N-1);
+            const double k = 2.0*std::cos(delta);
+            double c0 = std::cos((n-1)*delta);
+            double c1 = std::cos(n*delta);
+            for (; n < H; ++n) {
+                win[n] = a0 - a1*static_cast<value_type>(c1);
+                win_sum += win[n];
+                if (((n+1) & 255) == 0) {
+                    c0 = std::cos(n*delta);
+                    c1 = std::cos((n+1)*delta);
+                } else {
+                    double cn = k*c1 - c0;
+                    c0 = c1;
+                    c1 = cn;
+                }
+            }
         }
-
+        win_sum *= 2.0;
+        if (N & 1)
+            win_sum -= win[H-1];  // the midpoint has no mirror
+        for (n = 0; n < N/2; ++n)
+            win[N-1-n] = win[n];
+
+        // Normalization through one reciprocal and a vector multiply sweep
+        // (simd::div) instead of N divides; same policy in the other
+        // generators below.
         if (norm_sum) {
-            for (int n = 0; n < N; ++n)
-                win[n] /= win_sum;
+            if constexpr (std::is_same<value_type, float>::value) {
+                simd::div(win, N, static_cast<float>(win_sum));
+            } else {
+                const value_type inv = static_cast<value_type>(1.0/win_sum);
+                for (int n = 0; n < N; ++n)
+                    win[n] *= inv;
+            }
         }
     }
 
@@ -48,36 +244,85 @@ namespace phaseshift {
     void win_hamming(phaseshift::vector<value_type>* pwin, int N, bool norm_sum=true) {
         phaseshift::vector<value_type>& win = *pwin;
         win.resize(N);
-        win_hamming(win.data(), N, norm_sum);
+        if constexpr (std::is_same<value_type, float>::value) {
+            detail::win_cache_fill(detail::win_kind_hamming, N, norm_sum, 0.0f, pwin,
+                                   [&]() { win_hamming(win.data(), N, norm_sum); });
+        } else {
+            win_hamming(win.data(), N, norm_sum);
+        }
     }
 
 
     // Hann window -------------------------------------------------------------
+    // Same hot/force-inline/fast-math treatment as win_hamming_function.
+    #if defined(__GNUC__) && !defined(__clang__)
+        #pragma GCC push_options
+        #pragma GCC optimize("fast-math,tree-vectorize")
+    #endif
     template<typename value_type>
-    value_type win_hann_function(value_type nf, int N, bool center_at_zero=true) {
+    PHASESHIFT_HOT PHASESHIFT_ALWAYS_INLINE value_type win_hann_function(value_type nf, int N, bool center_at_zero=true) {
 
-        float a0 = 0.5f;
+        static constexpr float a0 = 0.5f;
 
         if (center_at_zero)
             nf += static_cast<float>(N-1)/2;
 
-        return a0 - (1.0f-a0)*std::cos(static_cast<value_type>(2*M_PI*nf/(N-1)));
+        // Keep the argument in value_type: for float this selects cosf and
+        // avoids the double promotion that M_PI would otherwise force.
+        return a0 - (1.0f-a0)*std::cos(static_cast<value_type>(2*M_PI)*nf/static_cast<value_type>(N-1));
     }
+    #if defined(__GNUC__) && !defined(__clang__)
+        #pragma GCC pop_options
+    #endif
 
     template<typename value_type>
     void win_hann(value_type* win, int N, bool norm_sum=true) {
 
-        float a0 = 0.5f;
-
-        float win_sum = 0.0f;
-        for (int n = 0; n < N; ++n) {
-            win[n] = a0 - (1.0f-a0)*std::cos(static_cast<value_type>(2*M_PI*n/(N-1)));
-            win_sum += win[n];
+        static constexpr float a0 = 0.5f;
+
+        // Symmetric around (N-1)/2: first half evaluated, rest mirrored
+        const int H = (N+1)/2;
+
+        double win_sum = 0.0;  // double: N float roundings would bias the normalization
+        int n = 0;
+        #if defined(PHASESHIFT_SIMD_X86) && defined(__AVX2__)
+            if constexpr (std::is_same<value_type, float>::value)
+                n = detail::win_raised_cos_avx2(win, N, H, a0, &win_sum);
+        #endif
+        // Chebyshev recurrence, see win_hamming
+        if (n < H) {
+            static constexpr float a1 = 1.0f - a0;
+            const double delta = 2*M_PI/(N-1);
+            const double k = 2.0*std::cos(delta);
+            double c0 = std::cos((n-1)*delta);
+            double c1 = std::cos(n*delta);
+            for (; n < H; ++n) {
+                win[n] = a0 - a1*static_cast<value_type>(c1);
+                win_sum += win[n];
+                if (((n+1) & 255) == 0) {
+                    c0 = std::cos(n*delta);
+                    c1 = std::cos((n+1)*delta);
+                } else {
+                    double cn = k*c1 - c0;
+                    c0 = c1;
+                    c1 = cn;
+                }
+            }
         }
+        win_sum *= 2.0;
+        if (N & 1)
+            win_sum -= win[H-1];  // the midpoint has no mirror
+        for (n = 0; n < N/2; ++n)
+            win[N-1-n] = win[n];
 
         if (norm_sum) {
-            for (int n = 0; n < N; ++n)
-                win[n] /= win_sum;
+            if constexpr (std::is_same<value_type, float>::value) {
+                simd::div(win, N, static_cast<float>(win_sum));
+            } else {
+                const value_type inv = static_cast<value_type>(1.0/win_sum);
+                for (int n = 0; n < N; ++n)
+                    win[n] *= inv;
+            }
         }
     }
 
@@ -85,7 +330,63 @@ namespace phaseshift {
     void win_hann(phaseshift::vector<value_type>* pwin, int N, bool norm_sum=true) {
         phaseshift::vector<value_type>& win = *pwin;
         win.resize(N);
-        win_hann(win.data(), N, norm_sum);
+        if constexpr (std::is_same<value_type, float>::value) {
+            detail::win_cache_fill(detail::win_kind_hann, N, norm_sum, 0.0f, pwin,
+                                   [&]() { win_hann(win.data(), N, norm_sum); });
+        } else {
+            win_hann(win.data(), N, norm_sum);
+        }
+    }
+
+
+    namespace detail {
+        //! cos usable in constant expressions (std::cos is not constexpr in
+        //! C++17): one turn of argument reduction to [-pi,pi] and a Taylor
+        //! expansion in double, exact to ~1e-17 there. Compile-time only;
+        //! runtime code uses std::cos or simd::cos_ps.
+        constexpr double cos_constexpr(double x) {
+            constexpr double twopi_d = 6.283185307179586476925286766559;
+            const double k = static_cast<double>(static_cast<long long>(x/twopi_d + ((x >= 0.0) ? 0.5 : -0.5)));
+            x -= k*twopi_d;
+            double term = 1.0;
+            double sum = 1.0;
+            for (int i = 1; i <= 15; ++i) {
+                term *= -x*x / ((2.0*i - 1.0)*(2.0*i));
+                sum += term;
+            }
+            return sum;
+        }
+
+        template<int N>
+        constexpr std::array<float, N> make_raised_cos_window(double a0, bool norm_sum) {
+            static_assert(N >= 2, "phaseshift::detail::make_raised_cos_window: the phase step is undefined below two samples");
+            std::array<float, N> win{};
+            double sum = 0.0;
+            for (int n = 0; n < N; ++n) {
+                const double w = a0 - (1.0-a0)*cos_constexpr(2*M_PI*n/(N-1));
+                win[n] = static_cast<float>(w);
+                sum += w;
+            }
+            if (norm_sum) {
+                for (int n = 0; n < N; ++n)
+                    win[n] = static_cast<float>(win[n]/sum);
+            }
+            return win;
+        }
+    }  // namespace detail
+
+    //! Compile-time counterparts of win_hann/win_hamming for pipelines whose
+    //! window length is a template constant: assign the result to a constexpr
+    //! (or static const) array and the whole generation folds away, leaving a
+    //! table in .rodata. No caching or SIMD involved, so prefer the runtime
+    //! generators whenever N is only known at run time.
+    template<int N>
+    constexpr std::array<float, N> make_hann_window(bool norm_sum=true) {
+        return detail::make_raised_cos_window<N>(0.5, norm_sum);
+    }
+    template<int N>
+    constexpr std::array<float, N> make_hamming_window(bool norm_sum=true) {
+        return detail::make_raised_cos_window<N>(25.0/46.0, norm_sum);
     }
 
 
@@ -93,19 +394,81 @@ namespace phaseshift {
     template<typename value_type>
     void win_blackman(value_type* win, int N, bool norm_sum=true) {
 
-        float a = 0.16f;
-
-        float a0 = (1.0f-a)*0.5f;
-
-        float win_sum = 0.0f;
-        for (int n = 0; n < N; ++n) {
-            win[n] = a0 - 0.5f*std::cos(static_cast<value_type>(2*M_PI*n/(N-1))) + 0.5f*a*std::cos(static_cast<value_type>(4*M_PI*n/(N-1)));
-            win_sum += win[n];
+        static constexpr float a = 0.16f;
+        static constexpr float a0 = (1.0f-a)*0.5f;
+        static constexpr float a2 = 0.5f*a;
+
+        // Symmetric around (N-1)/2: first half evaluated, rest mirrored
+        const int H = (N+1)/2;
+
+        double win_sum = 0.0;  // double: N float roundings would bias the normalization
+        int n = 0;
+        #if defined(PHASESHIFT_SIMD_X86) && defined(__AVX2__)
+            // Two cosine terms here: the second harmonic reuses the phase
+            // vector doubled, so the reduction constants stay in registers.
+            if constexpr (std::is_same<value_type, float>::value) {
+                const __m256 vstep = _mm256_set1_ps(static_cast<float>(2*M_PI/(N-1)));
+                const __m256 vbase = _mm256_setr_ps(0, 1, 2, 3, 4, 5, 6, 7);
+                const __m256 va0 = _mm256_set1_ps(a0);
+                const __m256 vhalf = _mm256_set1_ps(0.5f);
+                const __m256 vhalfa = _mm256_set1_ps(a2);
+                __m256d vsum0 = _mm256_setzero_pd();
+                __m256d vsum1 = _mm256_setzero_pd();
+                for (; n+8 <= H; n += 8) {
+                    __m256 phase = _mm256_mul_ps(_mm256_add_ps(vbase, _mm256_set1_ps(static_cast<float>(n))), vstep);
+                    __m256 w = _mm256_sub_ps(va0, _mm256_mul_ps(vhalf, simd::cos_ps(phase)));
+                    w = _mm256_add_ps(w, _mm256_mul_ps(vhalfa, simd::cos_ps(_mm256_add_ps(phase, phase))));
+                    _mm256_storeu_ps(win+n, w);
+                    vsum0 = _mm256_add_pd(vsum0, _mm256_cvtps_pd(_mm256_castps256_ps128(w)));
+                    vsum1 = _mm256_add_pd(vsum1, _mm256_cvtps_pd(_mm256_extractf128_ps(w, 1)));
+                }
+                const __m256d vs = _mm256_add_pd(vsum0, vsum1);
+                __m128d s = _mm_add_pd(_mm256_castpd256_pd128(vs), _mm256_extractf128_pd(vs, 1));
+                win_sum += _mm_cvtsd_f64(_mm_add_sd(s, _mm_unpackhi_pd(s, s)));
+            }
+        #endif
+        // Two independent Chebyshev recurrences, one per harmonic,
+        // see win_hamming
+        if (n < H) {
+            const double delta = 2*M_PI/(N-1);
+            const double k1 = 2.0*std::cos(delta);
+            const double k2 = 2.0*std::cos(2.0*delta);
+            double c10 = std::cos((n-1)*delta);
+            double c11 = std::cos(n*delta);
+            double c20 = std::cos((n-1)*2.0*delta);
+            double c21 = std::cos(n*2.0*delta);
+            for (; n < H; ++n) {
+                win[n] = a0 - 0.5f*static_cast<value_type>(c11) + a2*static_cast<value_type>(c21);
+                win_sum += win[n];
+                if (((n+1) & 255) == 0) {
+                    c10 = std::cos(n*delta);
+                    c11 = std::cos((n+1)*delta);
+                    c20 = std::cos(n*2.0*delta);
+                    c21 = std::cos((n+1)*2.0*delta);
+                } else {
+                    double cn = k1*c11 - c10;
+                    c10 = c11;
+                    c11 = cn;
+                    cn = k2*c21 - c20;
+                    c20 = c21;
+                    c21 = cn;
+                }
+            }
         }
+        win_sum *= 2.0;
+        if (N & 1)
+            win_sum -= win[H-1];  // the midpoint has no mirror
+        for (n = 0; n < N/2; ++n)
+            win[N-1-n] = win[n];
 
         if (norm_sum) {
-            for (int n = 0; n < N; ++n)
-                win[n] /= win_sum;
+            if constexpr (std::is_same<value_type, float>::value) {
+                simd::div(win, N, static_cast<float>(win_sum));
+            } else {
+                const value_type inv = static_cast<value_type>(1.0/win_sum);
+                for (int n = 0; n < N; ++n)
+                    win[n] *= inv;
+            }
         }
     }
 
@@ -113,7 +476,12 @@ namespace phaseshift {
     void win_blackman(phaseshift::vector<value_type>* pwin, int N, bool norm_sum=true) {
         phaseshift::vector<value_type>& win = *pwin;
         win.resize(N);
-        win_blackman(win.data(), N, norm_sum);
+        if constexpr (std::is_same<value_type, float>::value) {
+            detail::win_cache_fill(detail::win_kind_blackman, N, norm_sum, 0.0f, pwin,
+                                   [&]() { win_blackman(win.data(), N, norm_sum); });
+        } else {
+            win_blackman(win.data(), N, norm_sum);
+        }
     }
 
 
@@ -121,16 +489,54 @@ namespace phaseshift {
     template<typename value_type>
     void win_gaussian(value_type* win, int N, bool norm_sum=true, float sigma=0.5f) {
 
-        float win_sum = 0.0f;
-        for (int n = 0; n < N; ++n) {
-            float d = (n-N/2) / (sigma*N/2);
+        // The grid is centered on n=N/2 (not (N-1)/2), so the mirror of n is
+        // 2*mid-n: N-1-n when N is odd, N-n when N is even with win[0] left
+        // unpaired. Only the first half pays the exp.
+        const int mid = N/2;
+        const int M = (N == 0) ? 0 : mid+1;
+
+        double win_sum = 0.0;  // double: N float roundings would bias the normalization
+        int n = 0;
+        // 8 exponentials per iteration through exp_ps for the float
+        // instantiation; the per-sample divide becomes a reciprocal multiply.
+        #if defined(PHASESHIFT_SIMD_X86) && defined(__AVX2__)
+            if constexpr (std::is_same<value_type, float>::value) {
+                const __m256 vbase = _mm256_setr_ps(0, 1, 2, 3, 4, 5, 6, 7);
+                const __m256 vmid = _mm256_set1_ps(static_cast<float>(mid));
+                const __m256 vinvs = _mm256_set1_ps(1.0f/(sigma*N/2));
+                const __m256 vmhalf = _mm256_set1_ps(-0.5f);
+                __m256d vsum0 = _mm256_setzero_pd();
+                __m256d vsum1 = _mm256_setzero_pd();
+                for (; n+8 <= M; n += 8) {
+                    __m256 d = _mm256_mul_ps(_mm256_sub_ps(_mm256_add_ps(vbase, _mm256_set1_ps(static_cast<float>(n))), vmid), vinvs);
+                    __m256 w = simd::exp_ps(_mm256_mul_ps(vmhalf, _mm256_mul_ps(d, d)));
+                    _mm256_storeu_ps(win+n, w);
+                    vsum0 = _mm256_add_pd(vsum0, _mm256_cvtps_pd(_mm256_castps256_ps128(w)));
+                    vsum1 = _mm256_add_pd(vsum1, _mm256_cvtps_pd(_mm256_extractf128_ps(w, 1)));
+                }
+                const __m256d vs = _mm256_add_pd(vsum0, vsum1);
+                __m128d s = _mm_add_pd(_mm256_castpd256_pd128(vs), _mm256_extractf128_pd(vs, 1));
+                win_sum += _mm_cvtsd_f64(_mm_add_sd(s, _mm_unpackhi_pd(s, s)));
+            }
+        #endif
+        for (; n < M; ++n) {
+            float d = (n-mid) / (sigma*N/2);
             win[n] = std::exp(-0.5f*d*d);
             win_sum += win[n];
         }
+        for (n = (N & 1) ? 0 : 1; n < mid; ++n) {
+            win[2*mid-n] = win[n];
+            win_sum += win[n];
+        }
 
         if (norm_sum) {
-            for (int n = 0; n < N; ++n)
-                win[n] /= win_sum;
+            if constexpr (std::is_same<value_type, float>::value) {
+                simd::div(win, N, static_cast<float>(win_sum));
+            } else {
+                const value_type inv = static_cast<value_type>(1.0/win_sum);
+                for (int n = 0; n < N; ++n)
+                    win[n] *= inv;
+            }
         }
     }
 
@@ -138,58 +544,121 @@ namespace phaseshift {
     void win_gaussian(phaseshift::vector<value_type>* pwin, int N, bool norm_sum=true, float sigma=0.5f) {
         phaseshift::vector<value_type>& win = *pwin;
         win.resize(N);
-        win_gaussian(win.data(), N, norm_sum);
+        // sigma is forwarded now (it used to be silently dropped here) and
+        // distinguishes the cache entries.
+        if constexpr (std::is_same<value_type, float>::value) {
+            detail::win_cache_fill(detail::win_kind_gaussian, N, norm_sum, sigma, pwin,
+                                   [&]() { win_gaussian(win.data(), N, norm_sum, sigma); });
+        } else {
+            win_gaussian(win.data(), N, norm_sum, sigma);
+        }
     }
 
 
     // Kaiser window -----------------------------------------------------------
 
     //! 0-order modified bessel function [1,2]
-    //  The ininite sum will stop as soon as the square of the additive term is smaller than eps.
+    //  Piecewise approximation [3]: a 7-term polynomial in (x/3.75)^2 below
+    //  3.75, the asymptotic exp(x)/sqrt(x) form with a 9-term polynomial in
+    //  3.75/x above. Relative error stays below 2e-7 over the whole range,
+    //  where the former Taylor sum needed 20+ terms for large arguments.
     //  [1] https://en.wikipedia.org/wiki/Bessel_function#Modified_Bessel_functions:_I%CE%B1,_K%CE%B1
     //  [2] https://mathworld.wolfram.com/ModifiedBesselFunctionoftheFirstKind.html
+    //  [3] Abramowitz & Stegun, Handbook of Mathematical Functions, 9.8.1-9.8.2
     template<class value_type>
-    value_type modified_bessel_firstkind_zeroorder(value_type x, double eps, int K_max=24){
-        if (x==static_cast<value_type>(0))
-            return static_cast<value_type>(1);
-
-        value_type sum = static_cast<value_type>(1);
-        value_type frac_pow = static_cast<value_type>(1);
-        value_type frac_facto = static_cast<value_type>(1);
-        value_type frac;
-        for (int k=1; k < K_max; ++k) {
-            frac_pow *= 0.5*x;
-            frac_facto *= k;
-            frac = frac_pow/frac_facto;
-            sum += frac*frac;
-            if (frac*frac<eps)
-                break;
+    value_type modified_bessel_firstkind_zeroorder(value_type x) {
+        double ax = std::abs(static_cast<double>(x));
+        double res;
+        if (ax < 3.75) {
+            double t = ax/3.75;
+            t *= t;
+            res = 1.0 + t*(3.5156229 + t*(3.0899424 + t*(1.2067492
+                      + t*(0.2659732 + t*(0.0360768 + t*0.0045813)))));
+        } else {
+            double y = 3.75/ax;
+            res = (std::exp(ax)/std::sqrt(ax))
+                  * (0.39894228 + y*(0.01328592 + y*(0.00225319 + y*(-0.00157565
+                      + y*(0.00916281 + y*(-0.02057706 + y*(0.02635537
+                      + y*(-0.01647633 + y*0.00392377))))))));
         }
-
-        return sum;
+        return static_cast<value_type>(res);
     }
 
-    //! [1] https://en.wikipedia.org/wiki/Kaiser_window
+    namespace detail {
     template<typename vector>
-    void win_kaiser(vector* pwin, int N, float alpha=2.55, bool norm_sum=true) {
+    void win_kaiser_generate(vector* pwin, int N, float alpha, bool norm_sum) {
         vector& win = *pwin;
         win.resize(N);
 
         double pialpha = M_PI * alpha;
-        double eps = std::numeric_limits<float>::epsilon();
 
-        double oneover_mbfk_pialpha = 1.0f / modified_bessel_firstkind_zeroorder<double>(pialpha, eps);
-        double win_sum = 0.0f;
-        for(int n=0; n < N; ++n) {
+        // Symmetric around (N-1)/2: the Bessel evaluation only runs on the
+        // first half, the second half is mirrored.
+        const int H = (N+1)/2;
+
+        double oneover_mbfk_pialpha = 1.0f / modified_bessel_firstkind_zeroorder<double>(pialpha);
+        double win_sum = 0.0;
+        int n0 = 0;
+        // Contiguous float storage gets 8 Bessel evaluations per iteration;
+        // the float polynomials and exp_ps stay within ~1e-6 relative of the
+        // double path, below what the normalized window resolves.
+        #if defined(PHASESHIFT_SIMD_X86) && defined(__AVX2__)
+            if constexpr (phaseshift::dev::has_contiguous_data<vector>::value
+                          && std::is_same_v<typename vector::value_type, float>) {
+                float* pwin = win.data();
+                const __m256 vbase = _mm256_setr_ps(0, 1, 2, 3, 4, 5, 6, 7);
+                const __m256 vcenter = _mm256_set1_ps(float(N-1)/2);
+                const __m256 vscale = _mm256_set1_ps(2.0f/float(N-1));
+                const __m256 vpialpha = _mm256_set1_ps(static_cast<float>(pialpha));
+                const __m256 vnorm = _mm256_set1_ps(static_cast<float>(oneover_mbfk_pialpha));
+                const __m256 vone = _mm256_set1_ps(1.0f);
+                __m256d vsum0 = _mm256_setzero_pd();
+                __m256d vsum1 = _mm256_setzero_pd();
+                for (; n0+8 <= H; n0 += 8) {
+                    __m256 root = _mm256_mul_ps(_mm256_sub_ps(_mm256_add_ps(vbase, _mm256_set1_ps(static_cast<float>(n0))), vcenter), vscale);
+                    // 1-root^2 can land an ulp below zero at the edges
+                    __m256 under = _mm256_max_ps(_mm256_sub_ps(vone, _mm256_mul_ps(root, root)), _mm256_setzero_ps());
+                    __m256 arg = _mm256_mul_ps(vpialpha, _mm256_sqrt_ps(under));
+                    __m256 w = _mm256_mul_ps(detail::bessel_i0_ps(arg), vnorm);
+                    _mm256_storeu_ps(pwin+n0, w);
+                    vsum0 = _mm256_add_pd(vsum0, _mm256_cvtps_pd(_mm256_castps256_ps128(w)));
+                    vsum1 = _mm256_add_pd(vsum1, _mm256_cvtps_pd(_mm256_extractf128_ps(w, 1)));
+                }
+                const __m256d vs = _mm256_add_pd(vsum0, vsum1);
+                __m128d s = _mm_add_pd(_mm256_castpd256_pd128(vs), _mm256_extractf128_pd(vs, 1));
+                win_sum += _mm_cvtsd_f64(_mm_add_sd(s, _mm_unpackhi_pd(s, s)));
+            }
+        #endif
+        for(int n=n0; n < H; ++n) {
             double root = 2 * (n-float(N-1)/2) / float(N-1);  // Definition is over [-N/2,N/2] not [0,N]
             double mbfk_arg = pialpha * std::sqrt(1-root*root);
-            win[n] = modified_bessel_firstkind_zeroorder<double>(mbfk_arg, eps) * oneover_mbfk_pialpha;
+            win[n] = modified_bessel_firstkind_zeroorder<double>(mbfk_arg) * oneover_mbfk_pialpha;
             win_sum += win[n];
         }
+        win_sum *= 2.0;
+        if (N & 1)
+            win_sum -= win[H-1];  // the midpoint has no mirror
+        for (int n = 0; n < N/2; ++n)
+            win[N-1-n] = win[n];
 
         if (norm_sum) {
+            // Generic container here, no contiguous guarantee: scalar sweep,
+            // still one reciprocal instead of N divides.
+            const double inv = 1.0/win_sum;
             for (int n = 0; n < N; ++n)
-                win[n] /= win_sum;
+                win[n] *= inv;
+        }
+    }
+    }  // namespace detail
+
+    //! [1] https://en.wikipedia.org/wiki/Kaiser_window
+    template<typename vector>
+    void win_kaiser(vector* pwin, int N, float alpha=2.55, bool norm_sum=true) {
+        if constexpr (std::is_same<vector, phaseshift::vector<float>>::value) {
+            detail::win_cache_fill(detail::win_kind_kaiser, N, norm_sum, alpha, pwin,
+                                   [&]() { detail::win_kaiser_generate(pwin, N, alpha, norm_sum); });
+        } else {
+            detail::win_kaiser_generate(pwin, N, alpha, norm_sum);
         }
     }
 
@@ -202,22 +671,55 @@ namespace phaseshift {
         assert(win.size() >= 4);
         assert(fs > 0.0f);
 
-        float thresh = phaseshift::db2lin(-6.0f);  // -6dB threshold
+        static constexpr float thresh = 0.5011872336272722f;  // -6dB threshold, db2lin(-6) folded at compile time
 
         int dftlen = phaseshift::nextpow2(win.size()) * dftlen_factor;
 
-        win_rfft.resize(dftlen/2+1);
+        // Skip the plan manager's lookup (and a possible plan creation inside
+        // rfft(.)) when the same dftlen is queried repeatedly, which is the
+        // common case when scanning window lengths of the same power of two.
+        thread_local int last_dftlen = -1;
+        if (dftlen != last_dftlen) {
+            fftscarf::planmanagerf().prepare(dftlen);
+            last_dftlen = dftlen;
+        }
+
+        win_rfft.resize(dftlen/2+1);  // No reallocation: the caller pre-allocated (see window_functions_test.cpp)
         fftscarf::planmanagerf().rfft(win, win_rfft, dftlen);
+
+        // Flatten the squared magnitudes into a float array before searching:
+        // the search only needs |W[k]|^2, so scanning 4 bytes per bin instead
+        // of the 8-byte complex pairs halves the traffic through the cache.
+        thread_local phaseshift::vector<float> mag2;
+        mag2.resize_allocation(win_rfft.size());
+        mag2.resize(win_rfft.size());
+        int k = 0;
+        #if defined(PHASESHIFT_SIMD_X86) && defined(__AVX2__)
+            const float* praw = reinterpret_cast<const float*>(win_rfft.data());
+            for (; k+8 <= mag2.size(); k += 8) {
+                __m256 a = _mm256_loadu_ps(praw + 2*k);      // r0 i0 r1 i1 | r2 i2 r3 i3
+                __m256 b = _mm256_loadu_ps(praw + 2*k + 8);  // r4 i4 r5 i5 | r6 i6 r7 i7
+                __m256 re = _mm256_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0));
+                __m256 im = _mm256_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1));
+                __m256 m = _mm256_fmadd_ps(re, re, _mm256_mul_ps(im, im));
+                // The shuffles interleave the two 128b lanes; put the bins
+                // back in order by swapping the middle 64b pairs.
+                m = _mm256_castpd_ps(_mm256_permute4x64_pd(_mm256_castps_pd(m), _MM_SHUFFLE(3, 1, 2, 0)));
+                _mm256_storeu_ps(mag2.data() + k, m);
+            }
+        #endif
+        for (; k < mag2.size(); ++k)
+            mag2[k] = std::norm(win_rfft[k]);
+
         int bwk = 0;
-        float amp0 = std::abs(win_rfft[bwk]);
-        float amp = std::abs(win_rfft[bwk])/amp0;
-        float amp_next = std::abs(win_rfft[bwk+1])/amp0;
-        while ((amp_next >= thresh) && (bwk+2 < win_rfft.size())) {
-            amp = amp_next;
+        const float thresh2_norm0 = thresh*thresh*mag2[0];
+        while ((mag2[bwk+1] >= thresh2_norm0) && (bwk+2 < mag2.size()))
             bwk++;
-            amp_next = std::abs(win_rfft[bwk+1])/amp0;
-        }
         // From here: W[bwk] > thresh <= W[bwk+1]
+        // Only the magnitudes needed for the interpolation get a sqrt.
+        const float amp0 = std::sqrt(mag2[0]);
+        float amp = std::sqrt(mag2[bwk])/amp0;
+        float amp_next = std::sqrt(mag2[bwk+1])/amp0;
         float g = (thresh - amp_next) / (amp - amp_next);
         float bwkinterp = bwk + (1.0f-g);  // Interpolate the bin index
         float bw_hz = 2* fs * float(bwkinterp) / dftlen;
@@ -0,0 +1,850 @@
+// Copyright (C) 2025 Gilles Degottex <gilles.degottex@gmail.com> All Rights Reserved.
+//
+// You may use, distribute and modify this code under the
+// terms of the Apache 2.0 license.
+// If you don't have a copy of this license, please visit:
+//     https://github.com/gillesdegottex/phaseshift
+//
+// Small SIMD kernels operating on contiguous float runs, shared by the
+// containers. Everything is resolved at compile time from the target ISA
+// (AVX-512 > AVX > SSE2 > NEON > scalar), each kernel keeping a scalar tail.
+// Being header-only, the containers cannot get per-TU compile flags like
+// audio_block/wav_convert does: the kernels here use whatever the build
+// baseline allows.
+
+#ifndef PHASESHIFT_SIMD_H_
+#define PHASESHIFT_SIMD_H_
+
+#include <phaseshift/utils.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__AVX512F__) || defined(__AVX2__) || defined(__AVX__)
+    #include <immintrin.h>
+    #define PHASESHIFT_SIMD_X86 1
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+    #include <emmintrin.h>
+    #define PHASESHIFT_SIMD_SSE2 1
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+    #include <arm_neon.h>
+    #define PHASESHIFT_SIMD_NEON 1
+#endif
+
+namespace phaseshift {
+    namespace simd {
+
+        //! Lanes of a float vector at the widest tier compiled in.
+        #if defined(__AVX512F__)
+            static constexpr int width_f32 = 16;
+        #elif defined(PHASESHIFT_SIMD_X86)
+            static constexpr int width_f32 = 8;
+        #elif defined(PHASESHIFT_SIMD_SSE2) || defined(PHASESHIFT_SIMD_NEON)
+            static constexpr int width_f32 = 4;
+        #else
+            static constexpr int width_f32 = 1;
+        #endif
+
+        //! Round a run length up to a whole number of vectors. Only valid on
+        //! buffers carrying at least one vector of writable tail slack (see
+        //! vector::resize_allocation): the kernels then consume the run in
+        //! full vectors and their scalar tails never execute.
+        inline int padded_size(int n) {
+            return (n + (width_f32-1)) & ~(width_f32-1);
+        }
+
+        inline void add(float* PHASESHIFT_RESTRICT p, int n, float v) {
+            int i = 0;
+            #if defined(__AVX512F__)
+                __m512 vv = _mm512_set1_ps(v);
+                for (; i+16 <= n; i += 16)
+                    _mm512_storeu_ps(p+i, _mm512_add_ps(_mm512_loadu_ps(p+i), vv));
+            #elif defined(PHASESHIFT_SIMD_X86)
+                __m256 vv = _mm256_set1_ps(v);
+                for (; i+8 <= n; i += 8)
+                    _mm256_storeu_ps(p+i, _mm256_add_ps(_mm256_loadu_ps(p+i), vv));
+            #elif defined(PHASESHIFT_SIMD_SSE2)
+                __m128 vv = _mm_set1_ps(v);
+                for (; i+4 <= n; i += 4)
+                    _mm_storeu_ps(p+i, _mm_add_ps(_mm_loadu_ps(p+i), vv));
+            #elif defined(PHASESHIFT_SIMD_NEON)
+                float32x4_t vv = vdupq_n_f32(v);
+                for (; i+4 <= n; i += 4)
+                    vst1q_f32(p+i, vaddq_f32(vld1q_f32(p+i), vv));
+            #endif
+            for (; i < n; ++i)
+                p[i] += v;
+        }
+
+        inline void sub(float* PHASESHIFT_RESTRICT p, int n, float v) {
+            int i = 0;
+            #if defined(__AVX512F__)
+                __m512 vv = _mm512_set1_ps(v);
+                for (; i+16 <= n; i += 16)
+                    _mm512_storeu_ps(p+i, _mm512_sub_ps(_mm512_loadu_ps(p+i), vv));
+            #elif defined(PHASESHIFT_SIMD_X86)
+                __m256 vv = _mm256_set1_ps(v);
+                for (; i+8 <= n; i += 8)
+                    _mm256_storeu_ps(p+i, _mm256_sub_ps(_mm256_loadu_ps(p+i), vv));
+            #elif defined(PHASESHIFT_SIMD_SSE2)
+                __m128 vv = _mm_set1_ps(v);
+                for (; i+4 <= n; i += 4)
+                    _mm_storeu_ps(p+i, _mm_sub_ps(_mm_loadu_ps(p+i), vv));
+            #elif defined(PHASESHIFT_SIMD_NEON)
+                float32x4_t vv = vdupq_n_f32(v);
+                for (; i+4 <= n; i += 4)
+                    vst1q_f32(p+i, vsubq_f32(vld1q_f32(p+i), vv));
+            #endif
+            for (; i < n; ++i)
+                p[i] -= v;
+        }
+
+        inline void mul(float* PHASESHIFT_RESTRICT p, int n, float v) {
+            int i = 0;
+            #if defined(__AVX512F__)
+                __m512 vv = _mm512_set1_ps(v);
+                for (; i+16 <= n; i += 16)
+                    _mm512_storeu_ps(p+i, _mm512_mul_ps(_mm512_loadu_ps(p+i), vv));
+            #elif defined(PHASESHIFT_SIMD_X86)
+                __m256 vv = _mm256_set1_ps(v);
+                for (; i+8 <= n; i += 8)
+                    _mm256_storeu_ps(p+i, _mm256_mul_ps(_mm256_loadu_ps(p+i), vv));
+            #elif defined(PHASESHIFT_SIMD_SSE2)
+                __m128 vv = _mm_set1_ps(v);
+                for (; i+4 <= n; i += 4)
+                    _mm_storeu_ps(p+i, _mm_mul_ps(_mm_loadu_ps(p+i), vv));
+            #elif defined(PHASESHIFT_SIMD_NEON)
+                float32x4_t vv = vdupq_n_f32(v);
+                for (; i+4 <= n; i += 4)
+                    vst1q_f32(p+i, vmulq_f32(vld1q_f32(p+i), vv));
+            #endif
+            for (; i < n; ++i)
+                p[i] *= v;
+        }
+
+        //! Division by a broadcast scalar: multiply by the reciprocal, which
+        //! breaks the 11+ cycle latency chain of divps (<1 ulp difference).
+        inline void div(float* PHASESHIFT_RESTRICT p, int n, float v) {
+            mul(p, n, 1.0f/v);
+        }
+
+        // Optional OpenMP threading of the pairwise kernels. A run long
+        // enough to be DRAM-bound cannot use the full memory bandwidth from
+        // one core, so it splits into chunks processed by the parallel team,
+        // each chunk re-entering the kernel below the threshold. Strictly
+        // opt-in: a worker team has no place on a real-time audio path.
+        #if defined(PHASESHIFT_ENABLE_OMP)
+            //! Below this many floats the team startup costs more than it earns.
+            static constexpr int parallel_size_min = 512*1024/int(sizeof(float));
+            //! Chunk granularity [floats]: a multiple of the cache line and of
+            //! every vector width, so two threads never share a line.
+            static constexpr int parallel_chunk_size = 16384;
+            #define PHASESHIFT_SIMD_PARALLEL_SPLIT(kernel, d, s, n) {                           \
+                if ((n) >= phaseshift::simd::parallel_size_min) {                               \
+                    const int nbchunks = ((n) + phaseshift::simd::parallel_chunk_size-1)        \
+                                         / phaseshift::simd::parallel_chunk_size;               \
+                    _Pragma("omp parallel for schedule(static)")                                \
+                    for (int c = 0; c < nbchunks; ++c) {                                        \
+                        const int off = c*phaseshift::simd::parallel_chunk_size;                \
+                        kernel((d)+off, (s)+off,                                                \
+                               std::min(phaseshift::simd::parallel_chunk_size, (n)-off));       \
+                    }                                                                           \
+                    return;                                                                     \
+                }                                                                               \
+            }
+        #else
+            #define PHASESHIFT_SIMD_PARALLEL_SPLIT(kernel, d, s, n)
+        #endif
+
+        // Pairwise kernels: d[i] op= s[i] over a contiguous run.
+        // The main loops are unrolled 4x: a single vector per iteration
+        // bottlenecks on the 2 loads/cycle issue rate, four independent
+        // vectors keep the ALU ports busy while the loads complete.
+
+        inline void add(float* PHASESHIFT_RESTRICT d, const float* PHASESHIFT_RESTRICT s, int n) {
+            PHASESHIFT_SIMD_PARALLEL_SPLIT(add, d, s, n)
+            int i = 0;
+            #if defined(__AVX512F__)
+                for (; i+64 <= n; i += 64) {
+                    __m512 a0 = _mm512_add_ps(_mm512_loadu_ps(d+i),    _mm512_loadu_ps(s+i));
+                    __m512 a1 = _mm512_add_ps(_mm512_loadu_ps(d+i+16), _mm512_loadu_ps(s+i+16));
+                    __m512 a2 = _mm512_add_ps(_mm512_loadu_ps(d+i+32), _mm512_loadu_ps(s+i+32));
+                    __m512 a3 = _mm512_add_ps(_mm512_loadu_ps(d+i+48), _mm512_loadu_ps(s+i+48));
+                    _mm512_storeu_ps(d+i,    a0);
+                    _mm512_storeu_ps(d+i+16, a1);
+                    _mm512_storeu_ps(d+i+32, a2);
+                    _mm512_storeu_ps(d+i+48, a3);
+                }
+                for (; i+16 <= n; i += 16)
+                    _mm512_storeu_ps(d+i, _mm512_add_ps(_mm512_loadu_ps(d+i), _mm512_loadu_ps(s+i)));
+            #elif defined(PHASESHIFT_SIMD_X86)
+                for (; i+32 <= n; i += 32) {
+                    __m256 a0 = _mm256_add_ps(_mm256_loadu_ps(d+i),    _mm256_loadu_ps(s+i));
+                    __m256 a1 = _mm256_add_ps(_mm256_loadu_ps(d+i+8),  _mm256_loadu_ps(s+i+8));
+                    __m256 a2 = _mm256_add_ps(_mm256_loadu_ps(d+i+16), _mm256_loadu_ps(s+i+16));
+                    __m256 a3 = _mm256_add_ps(_mm256_loadu_ps(d+i+24), _mm256_loadu_ps(s+i+24));
+                    _mm256_storeu_ps(d+i,    a0);
+                    _mm256_storeu_ps(d+i+8,  a1);
+                    _mm256_storeu_ps(d+i+16, a2);
+                    _mm256_storeu_ps(d+i+24, a3);
+                }
+                for (; i+8 <= n; i += 8)
+                    _mm256_storeu_ps(d+i, _mm256_add_ps(_mm256_loadu_ps(d+i), _mm256_loadu_ps(s+i)));
+            #elif defined(PHASESHIFT_SIMD_SSE2)
+                for (; i+16 <= n; i += 16) {
+                    __m128 a0 = _mm_add_ps(_mm_loadu_ps(d+i),    _mm_loadu_ps(s+i));
+                    __m128 a1 = _mm_add_ps(_mm_loadu_ps(d+i+4),  _mm_loadu_ps(s+i+4));
+                    __m128 a2 = _mm_add_ps(_mm_loadu_ps(d+i+8),  _mm_loadu_ps(s+i+8));
+                    __m128 a3 = _mm_add_ps(_mm_loadu_ps(d+i+12), _mm_loadu_ps(s+i+12));
+                    _mm_storeu_ps(d+i,    a0);
+                    _mm_storeu_ps(d+i+4,  a1);
+                    _mm_storeu_ps(d+i+8,  a2);
+                    _mm_storeu_ps(d+i+12, a3);
+                }
+                for (; i+4 <= n; i += 4)
+                    _mm_storeu_ps(d+i, _mm_add_ps(_mm_loadu_ps(d+i), _mm_loadu_ps(s+i)));
+            #elif defined(PHASESHIFT_SIMD_NEON)
+                for (; i+16 <= n; i += 16) {
+                    float32x4_t a0 = vaddq_f32(vld1q_f32(d+i),    vld1q_f32(s+i));
+                    float32x4_t a1 = vaddq_f32(vld1q_f32(d+i+4),  vld1q_f32(s+i+4));
+                    float32x4_t a2 = vaddq_f32(vld1q_f32(d+i+8),  vld1q_f32(s+i+8));
+                    float32x4_t a3 = vaddq_f32(vld1q_f32(d+i+12), vld1q_f32(s+i+12));
+                    vst1q_f32(d+i,    a0);
+                    vst1q_f32(d+i+4,  a1);
+                    vst1q_f32(d+i+8,  a2);
+                    vst1q_f32(d+i+12, a3);
+                }
+                for (; i+4 <= n; i += 4)
+                    vst1q_f32(d+i, vaddq_f32(vld1q_f32(d+i), vld1q_f32(s+i)));
+            #endif
+            for (; i < n; ++i)
+                d[i] += s[i];
+        }
+
+        inline void sub(float* PHASESHIFT_RESTRICT d, const float* PHASESHIFT_RESTRICT s, int n) {
+            PHASESHIFT_SIMD_PARALLEL_SPLIT(sub, d, s, n)
+            int i = 0;
+            #if defined(__AVX512F__)
+                for (; i+64 <= n; i += 64) {
+                    __m512 a0 = _mm512_sub_ps(_mm512_loadu_ps(d+i),    _mm512_loadu_ps(s+i));
+                    __m512 a1 = _mm512_sub_ps(_mm512_loadu_ps(d+i+16), _mm512_loadu_ps(s+i+16));
+                    __m512 a2 = _mm512_sub_ps(_mm512_loadu_ps(d+i+32), _mm512_loadu_ps(s+i+32));
+                    __m512 a3 = _mm512_sub_ps(_mm512_loadu_ps(d+i+48), _mm512_loadu_ps(s+i+48));
+                    _mm512_storeu_ps(d+i,    a0);
+                    _mm512_storeu_ps(d+i+16, a1);
+                    _mm512_storeu_ps(d+i+32, a2);
+                    _mm512_storeu_ps(d+i+48, a3);
+                }
+                for (; i+16 <= n; i += 16)
+                    _mm512_storeu_ps(d+i, _mm512_sub_ps(_mm512_loadu_ps(d+i), _mm512_loadu_ps(s+i)));
+            #elif defined(PHASESHIFT_SIMD_X86)
+                for (; i+32 <= n; i += 32) {
+                    __m256 a0 = _mm256_sub_ps(_mm256_loadu_ps(d+i),    _mm256_loadu_ps(s+i));
+                    __m256 a1 = _mm256_sub_ps(_mm256_loadu_ps(d+i+8),  _mm256_loadu_ps(s+i+8));
+                    __m256 a2 = _mm256_sub_ps(_mm256_loadu_ps(d+i+16), _mm256_loadu_ps(s+i+16));
+                    __m256 a3 = _mm256_sub_ps(_mm256_loadu_ps(d+i+24), _mm256_loadu_ps(s+i+24));
+                    _mm256_storeu_ps(d+i,    a0);
+                    _mm256_storeu_ps(d+i+8,  a1);
+                    _mm256_storeu_ps(d+i+16, a2);
+                    _mm256_storeu_ps(d+i+24, a3);
+                }
+                for (; i+8 <= n; i += 8)
+                    _mm256_storeu_ps(d+i, _mm256_sub_ps(_mm256_loadu_ps(d+i), _mm256_loadu_ps(s+i)));
+            #elif defined(PHASESHIFT_SIMD_SSE2)
+                for (; i+16 <= n; i += 16) {
+                    __m128 a0 = _mm_sub_ps(_mm_loadu_ps(d+i),    _mm_loadu_ps(s+i));
+                    __m128 a1 = _mm_sub_ps(_mm_loadu_ps(d+i+4),  _mm_loadu_ps(s+i+4));
+                    __m128 a2 = _mm_sub_ps(_mm_loadu_ps(d+i+8),  _mm_loadu_ps(s+i+8));
+                    __m128 a3 = _mm_sub_ps(_mm_loadu_ps(d+i+12), _mm_loadu_ps(s+i+12));
+                    _mm_storeu_ps(d+i,    a0);
+                    _mm_storeu_ps(d+i+4,  a1);
+                    _mm_storeu_ps(d+i+8,  a2);
+                    _mm_storeu_ps(d+i+12, a3);
+                }
+                for (; i+4 <= n; i += 4)
+                    _mm_storeu_ps(d+i, _mm_sub_ps(_mm_loadu_ps(d+i), _mm_loadu_ps(s+i)));
+            #elif defined(PHASESHIFT_SIMD_NEON)
+                for (; i+16 <= n; i += 16) {
+                    float32x4_t a0 = vsubq_f32(vld1q_f32(d+i),    vld1q_f32(s+i));
+                    float32x4_t a1 = vsubq_f32(vld1q_f32(d+i+4),  vld1q_f32(s+i+4));
+                    float32x4_t a2 = vsubq_f32(vld1q_f32(d+i+8),  vld1q_f32(s+i+8));
+                    float32x4_t a3 = vsubq_f32(vld1q_f32(d+i+12), vld1q_f32(s+i+12));
+                    vst1q_f32(d+i,    a0);
+                    vst1q_f32(d+i+4,  a1);
+                    vst1q_f32(d+i+8,  a2);
+                    vst1q_f32(d+i+12, a3);
+                }
+                for (; i+4 <= n; i += 4)
+                    vst1q_f32(d+i, vsubq_f32(vld1q_f32(d+i), vld1q_f32(s+i)));
+            #endif
+            for (; i < n; ++i)
+                d[i] -= s[i];
+        }
+
+        inline void mul(float* PHASESHIFT_RESTRICT d, const float* PHASESHIFT_RESTRICT s, int n) {
+            PHASESHIFT_SIMD_PARALLEL_SPLIT(mul, d, s, n)
+            int i = 0;
+            #if defined(__AVX512F__)
+                for (; i+64 <= n; i += 64) {
+                    __m512 a0 = _mm512_mul_ps(_mm512_loadu_ps(d+i),    _mm512_loadu_ps(s+i));
+                    __m512 a1 = _mm512_mul_ps(_mm512_loadu_ps(d+i+16), _mm512_loadu_ps(s+i+16));
+                    __m512 a2 = _mm512_mul_ps(_mm512_loadu_ps(d+i+32), _mm512_loadu_ps(s+i+32));
+                    __m512 a3 = _mm512_mul_ps(_mm512_loadu_ps(d+i+48), _mm512_loadu_ps(s+i+48));
+                    _mm512_storeu_ps(d+i,    a0);
+                    _mm512_storeu_ps(d+i+16, a1);
+                    _mm512_storeu_ps(d+i+32, a2);
+                    _mm512_storeu_ps(d+i+48, a3);
+                }
+                for (; i+16 <= n; i += 16)
+                    _mm512_storeu_ps(d+i, _mm512_mul_ps(_mm512_loadu_ps(d+i), _mm512_loadu_ps(s+i)));
+            #elif defined(PHASESHIFT_SIMD_X86)
+                for (; i+32 <= n; i += 32) {
+                    __m256 a0 = _mm256_mul_ps(_mm256_loadu_ps(d+i),    _mm256_loadu_ps(s+i));
+                    __m256 a1 = _mm256_mul_ps(_mm256_loadu_ps(d+i+8),  _mm256_loadu_ps(s+i+8));
+                    __m256 a2 = _mm256_mul_ps(_mm256_loadu_ps(d+i+16), _mm256_loadu_ps(s+i+16));
+                    __m256 a3 = _mm256_mul_ps(_mm256_loadu_ps(d+i+24), _mm256_loadu_ps(s+i+24));
+                    _mm256_storeu_ps(d+i,    a0);
+                    _mm256_storeu_ps(d+i+8,  a1);
+                    _mm256_storeu_ps(d+i+16, a2);
+                    _mm256_storeu_ps(d+i+24, a3);
+                }
+                for (; i+8 <= n; i += 8)
+                    _mm256_storeu_ps(d+i, _mm256_mul_ps(_mm256_loadu_ps(d+i), _mm256_loadu_ps(s+i)));
+            #elif defined(PHASESHIFT_SIMD_SSE2)
+                for (; i+16 <= n; i += 16) {
+                    __m128 a0 = _mm_mul_ps(_mm_loadu_ps(d+i),    _mm_loadu_ps(s+i));
+                    __m128 a1 = _mm_mul_ps(_mm_loadu_ps(d+i+4),  _mm_loadu_ps(s+i+4));
+                    __m128 a2 = _mm_mul_ps(_mm_loadu_ps(d+i+8),  _mm_loadu_ps(s+i+8));
+                    __m128 a3 = _mm_mul_ps(_mm_loadu_ps(d+i+12), _mm_loadu_ps(s+i+12));
+                    _mm_storeu_ps(d+i,    a0);
+                    _mm_storeu_ps(d+i+4,  a1);
+                    _mm_storeu_ps(d+i+8,  a2);
+                    _mm_storeu_ps(d+i+12, a3);
+                }
+                for (; i+4 <= n; i += 4)
+                    _mm_storeu_ps(d+i, _mm_mul_ps(_mm_loadu_ps(d+i), _mm_loadu_ps(s+i)));
+            #elif defined(PHASESHIFT_SIMD_NEON)
+                for (; i+16 <= n; i += 16) {
+                    float32x4_t a0 = vmulq_f32(vld1q_f32(d+i),    vld1q_f32(s+i));
+                    float32x4_t a1 = vmulq_f32(vld1q_f32(d+i+4),  vld1q_f32(s+i+4));
+                    float32x4_t a2 = vmulq_f32(vld1q_f32(d+i+8),  vld1q_f32(s+i+8));
+                    float32x4_t a3 = vmulq_f32(vld1q_f32(d+i+12), vld1q_f32(s+i+12));
+                    vst1q_f32(d+i,    a0);
+                    vst1q_f32(d+i+4,  a1);
+                    vst1q_f32(d+i+8,  a2);
+                    vst1q_f32(d+i+12, a3);
+                }
+                for (; i+4 <= n; i += 4)
+                    vst1q_f32(d+i, vmulq_f32(vld1q_f32(d+i), vld1q_f32(s+i)));
+            #endif
+            for (; i < n; ++i)
+                d[i] *= s[i];
+        }
+
+        //! Element-wise division keeps true divps by default: the divisors are
+        //! arbitrary so the result stays bit-exact wrt IEEE division. No unroll
+        //! either, the divider unit is the bottleneck, not the load issue rate.
+        //! With PHASESHIFT_SIMD_RCP_DIV, the divide is replaced by a reciprocal
+        //! estimate refined with one Newton-Raphson step (~22 mantissa bits),
+        //! which trades a few ulps of accuracy against the ~14-cycle latency
+        //! and low throughput of the divider.
+        inline void div(float* PHASESHIFT_RESTRICT d, const float* PHASESHIFT_RESTRICT s, int n) {
+            PHASESHIFT_SIMD_PARALLEL_SPLIT(div, d, s, n)
+            int i = 0;
+            #if defined(__AVX512F__)
+                for (; i+16 <= n; i += 16)
+                    _mm512_storeu_ps(d+i, _mm512_div_ps(_mm512_loadu_ps(d+i), _mm512_loadu_ps(s+i)));
+            #elif defined(PHASESHIFT_SIMD_X86)
+                #if defined(PHASESHIFT_SIMD_RCP_DIV)
+                    const __m256 two = _mm256_set1_ps(2.0f);
+                    for (; i+8 <= n; i += 8) {
+                        __m256 b = _mm256_loadu_ps(s+i);
+                        __m256 r = _mm256_rcp_ps(b);
+                        #if defined(__FMA__)
+                            r = _mm256_mul_ps(r, _mm256_fnmadd_ps(b, r, two));
+                        #else
+                            r = _mm256_mul_ps(r, _mm256_sub_ps(two, _mm256_mul_ps(b, r)));
+                        #endif
+                        _mm256_storeu_ps(d+i, _mm256_mul_ps(_mm256_loadu_ps(d+i), r));
+                    }
+                #else
+                    for (; i+8 <= n; i += 8)
+                        _mm256_storeu_ps(d+i, _mm256_div_ps(_mm256_loadu_ps(d+i), _mm256_loadu_ps(s+i)));
+                #endif
+            #elif defined(PHASESHIFT_SIMD_SSE2)
+                #if defined(PHASESHIFT_SIMD_RCP_DIV)
+                    const __m128 two = _mm_set1_ps(2.0f);
+                    for (; i+4 <= n; i += 4) {
+                        __m128 b = _mm_loadu_ps(s+i);
+                        __m128 r = _mm_rcp_ps(b);
+                        r = _mm_mul_ps(r, _mm_sub_ps(two, _mm_mul_ps(b, r)));
+                        _mm_storeu_ps(d+i, _mm_mul_ps(_mm_loadu_ps(d+i), r));
+                    }
+                #else
+                    for (; i+4 <= n; i += 4)
+                        _mm_storeu_ps(d+i, _mm_div_ps(_mm_loadu_ps(d+i), _mm_loadu_ps(s+i)));
+                #endif
+            #elif defined(PHASESHIFT_SIMD_NEON)
+                #if defined(PHASESHIFT_SIMD_RCP_DIV)
+                    // vrecpe/vrecps are available on ARMv7 too
+                    for (; i+4 <= n; i += 4) {
+                        float32x4_t b = vld1q_f32(s+i);
+                        float32x4_t r = vrecpeq_f32(b);
+                        r = vmulq_f32(r, vrecpsq_f32(b, r));
+                        vst1q_f32(d+i, vmulq_f32(vld1q_f32(d+i), r));
+                    }
+                #elif defined(__aarch64__)
+                    // vdivq_f32 needs AArch64, ARMv7 falls back to the scalar loop
+                    for (; i+4 <= n; i += 4)
+                        vst1q_f32(d+i, vdivq_f32(vld1q_f32(d+i), vld1q_f32(s+i)));
+                #endif
+            #endif
+            for (; i < n; ++i)
+                d[i] /= s[i];
+        }
+
+        //! True when no value in [p, p+n) is NaN or Inf. The exponent bits
+        //! are tested with integer compares (exponent all ones means NaN or
+        //! Inf) OR-ed into one accumulator, so the sweep carries a single
+        //! final branch per vector tier and no unordered FP compares.
+        inline bool is_finite(const float* PHASESHIFT_RESTRICT p, int n) {
+            int i = 0;
+            #if defined(PHASESHIFT_SIMD_X86) && defined(__AVX2__)
+                const __m256i expmask8 = _mm256_set1_epi32(0x7f800000);
+                __m256i acc8 = _mm256_setzero_si256();
+                for (; i+8 <= n; i += 8) {
+                    __m256i bits = _mm256_castps_si256(_mm256_loadu_ps(p+i));
+                    acc8 = _mm256_or_si256(acc8, _mm256_cmpeq_epi32(_mm256_and_si256(bits, expmask8), expmask8));
+                }
+                if (!_mm256_testz_si256(acc8, acc8))
+                    return false;
+            #elif defined(PHASESHIFT_SIMD_X86) || defined(PHASESHIFT_SIMD_SSE2)
+                // 128-bit integer ops: available from SSE2 up, also on
+                // AVX-only targets where the 256-bit integer set is not.
+                const __m128i expmask4 = _mm_set1_epi32(0x7f800000);
+                __m128i acc4 = _mm_setzero_si128();
+                for (; i+4 <= n; i += 4) {
+                    __m128i bits = _mm_castps_si128(_mm_loadu_ps(p+i));
+                    acc4 = _mm_or_si128(acc4, _mm_cmpeq_epi32(_mm_and_si128(bits, expmask4), expmask4));
+                }
+                if (_mm_movemask_epi8(acc4) != 0)
+                    return false;
+            #elif defined(PHASESHIFT_SIMD_NEON)
+                const uint32x4_t expmask4 = vdupq_n_u32(0x7f800000u);
+                uint32x4_t acc4 = vdupq_n_u32(0u);
+                for (; i+4 <= n; i += 4) {
+                    uint32x4_t bits = vreinterpretq_u32_f32(vld1q_f32(p+i));
+                    acc4 = vorrq_u32(acc4, vceqq_u32(vandq_u32(bits, expmask4), expmask4));
+                }
+                uint32x2_t acc2 = vorr_u32(vget_low_u32(acc4), vget_high_u32(acc4));
+                if ((vget_lane_u32(acc2, 0) | vget_lane_u32(acc2, 1)) != 0u)
+                    return false;
+            #endif
+            for (; i < n; ++i) {
+                uint32_t bits;
+                std::memcpy(&bits, p+i, sizeof(bits));
+                if ((bits & 0x7f800000u) == 0x7f800000u)
+                    return false;
+            }
+            return true;
+        }
+
+        //! In-place reciprocal p[i] = 1/p[i]. True divide by default so the
+        //! result is bit-exact; the refined estimate applies under
+        //! PHASESHIFT_SIMD_RCP_DIV as for div().
+        inline void rcp(float* PHASESHIFT_RESTRICT p, int n) {
+            int i = 0;
+            #if defined(__AVX512F__)
+                const __m512 one16 = _mm512_set1_ps(1.0f);
+                for (; i+16 <= n; i += 16)
+                    _mm512_storeu_ps(p+i, _mm512_div_ps(one16, _mm512_loadu_ps(p+i)));
+            #elif defined(PHASESHIFT_SIMD_X86)
+                #if defined(PHASESHIFT_SIMD_RCP_DIV)
+                    const __m256 two = _mm256_set1_ps(2.0f);
+                    for (; i+8 <= n; i += 8) {
+                        __m256 b = _mm256_loadu_ps(p+i);
+                        __m256 r = _mm256_rcp_ps(b);
+                        #if defined(__FMA__)
+                            r = _mm256_mul_ps(r, _mm256_fnmadd_ps(b, r, two));
+                        #else
+                            r = _mm256_mul_ps(r, _mm256_sub_ps(two, _mm256_mul_ps(b, r)));
+                        #endif
+                        _mm256_storeu_ps(p+i, r);
+                    }
+                #else
+                    const __m256 one8 = _mm256_set1_ps(1.0f);
+                    for (; i+8 <= n; i += 8)
+                        _mm256_storeu_ps(p+i, _mm256_div_ps(one8, _mm256_loadu_ps(p+i)));
+                #endif
+            #elif defined(PHASESHIFT_SIMD_SSE2)
+                const __m128 one4 = _mm_set1_ps(1.0f);
+                for (; i+4 <= n; i += 4)
+                    _mm_storeu_ps(p+i, _mm_div_ps(one4, _mm_loadu_ps(p+i)));
+            #elif defined(PHASESHIFT_SIMD_NEON)
+                #if defined(PHASESHIFT_SIMD_RCP_DIV)
+                    for (; i+4 <= n; i += 4) {
+                        float32x4_t b = vld1q_f32(p+i);
+                        float32x4_t r = vrecpeq_f32(b);
+                        r = vmulq_f32(r, vrecpsq_f32(b, r));
+                        vst1q_f32(p+i, r);
+                    }
+                #elif defined(__aarch64__)
+                    const float32x4_t one4 = vdupq_n_f32(1.0f);
+                    for (; i+4 <= n; i += 4)
+                        vst1q_f32(p+i, vdivq_f32(one4, vld1q_f32(p+i)));
+                #endif
+            #endif
+            for (; i < n; ++i)
+                p[i] = 1.0f/p[i];
+        }
+
+        //! Fused multiply-add d[i] = d[i]*a[i] + b[i]. One sweep over the
+        //! destination instead of a multiply pass followed by an add pass;
+        //! with three streams in flight the loads saturate before the FMA
+        //! units do, so there is no point unrolling further.
+        inline void fma(float* PHASESHIFT_RESTRICT d, const float* PHASESHIFT_RESTRICT a, const float* PHASESHIFT_RESTRICT b, int n) {
+            int i = 0;
+            #if defined(__AVX512F__)
+                for (; i+16 <= n; i += 16)
+                    _mm512_storeu_ps(d+i, _mm512_fmadd_ps(_mm512_loadu_ps(d+i), _mm512_loadu_ps(a+i), _mm512_loadu_ps(b+i)));
+            #elif defined(PHASESHIFT_SIMD_X86)
+                for (; i+8 <= n; i += 8) {
+                    #if defined(__FMA__)
+                        _mm256_storeu_ps(d+i, _mm256_fmadd_ps(_mm256_loadu_ps(d+i), _mm256_loadu_ps(a+i), _mm256_loadu_ps(b+i)));
+                    #else
+                        _mm256_storeu_ps(d+i, _mm256_add_ps(_mm256_mul_ps(_mm256_loadu_ps(d+i), _mm256_loadu_ps(a+i)), _mm256_loadu_ps(b+i)));
+                    #endif
+                }
+            #elif defined(PHASESHIFT_SIMD_SSE2)
+                for (; i+4 <= n; i += 4)
+                    _mm_storeu_ps(d+i, _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(d+i), _mm_loadu_ps(a+i)), _mm_loadu_ps(b+i)));
+            #elif defined(PHASESHIFT_SIMD_NEON)
+                // vmlaq accumulates in place, available on ARMv7 as well
+                for (; i+4 <= n; i += 4)
+                    vst1q_f32(d+i, vmlaq_f32(vld1q_f32(b+i), vld1q_f32(d+i), vld1q_f32(a+i)));
+            #endif
+            for (; i < n; ++i)
+                d[i] = d[i]*a[i] + b[i];
+        }
+
+        //! Fused d[i] = d[i]*m[i]/v[i]: one load/store of the destination
+        //! where a *= pass followed by a /= pass would sweep the ring twice.
+        //! The divide follows the same policy as div() above.
+        inline void mul_div(float* PHASESHIFT_RESTRICT d, const float* PHASESHIFT_RESTRICT m, const float* PHASESHIFT_RESTRICT v, int n) {
+            int i = 0;
+            #if defined(__AVX512F__)
+                for (; i+16 <= n; i += 16)
+                    _mm512_storeu_ps(d+i, _mm512_div_ps(_mm512_mul_ps(_mm512_loadu_ps(d+i), _mm512_loadu_ps(m+i)), _mm512_loadu_ps(v+i)));
+            #elif defined(PHASESHIFT_SIMD_X86)
+                #if defined(PHASESHIFT_SIMD_RCP_DIV)
+                    const __m256 two = _mm256_set1_ps(2.0f);
+                    for (; i+8 <= n; i += 8) {
+                        __m256 b = _mm256_loadu_ps(v+i);
+                        __m256 r = _mm256_rcp_ps(b);
+                        #if defined(__FMA__)
+                            r = _mm256_mul_ps(r, _mm256_fnmadd_ps(b, r, two));
+                        #else
+                            r = _mm256_mul_ps(r, _mm256_sub_ps(two, _mm256_mul_ps(b, r)));
+                        #endif
+                        _mm256_storeu_ps(d+i, _mm256_mul_ps(_mm256_mul_ps(_mm256_loadu_ps(d+i), _mm256_loadu_ps(m+i)), r));
+                    }
+                #else
+                    for (; i+8 <= n; i += 8)
+                        _mm256_storeu_ps(d+i, _mm256_div_ps(_mm256_mul_ps(_mm256_loadu_ps(d+i), _mm256_loadu_ps(m+i)), _mm256_loadu_ps(v+i)));
+                #endif
+            #elif defined(PHASESHIFT_SIMD_SSE2)
+                for (; i+4 <= n; i += 4)
+                    _mm_storeu_ps(d+i, _mm_div_ps(_mm_mul_ps(_mm_loadu_ps(d+i), _mm_loadu_ps(m+i)), _mm_loadu_ps(v+i)));
+            #elif defined(PHASESHIFT_SIMD_NEON) && defined(__aarch64__)
+                for (; i+4 <= n; i += 4)
+                    vst1q_f32(d+i, vdivq_f32(vmulq_f32(vld1q_f32(d+i), vld1q_f32(m+i)), vld1q_f32(v+i)));
+            #endif
+            for (; i < n; ++i)
+                d[i] = d[i]*m[i]/v[i];
+        }
+
+        //! Above this run size the stores bypass the cache: a buffer bigger
+        //! than the LLC would only evict useful lines while being overwritten.
+        static constexpr size_t stream_bytes_min = 4u*1024u*1024u;
+
+        //! Fill with a broadcast value. A fill overwrites every byte, so on
+        //! runs above stream_bytes_min the stores are non-temporal, which
+        //! skips the read-for-ownership traffic and the cache allocation.
+        inline void fill(float* PHASESHIFT_RESTRICT p, int n, float v) {
+            int i = 0;
+            #if defined(PHASESHIFT_SIMD_X86)
+                __m256 vv = _mm256_set1_ps(v);
+                if (size_t(n)*sizeof(float) > stream_bytes_min) {
+                    // Non-temporal stores require vector-aligned addresses
+                    for (; (i < n) && ((reinterpret_cast<uintptr_t>(p+i) & 31u) != 0); ++i)
+                        p[i] = v;
+                    for (; i+8 <= n; i += 8)
+                        _mm256_stream_ps(p+i, vv);
+                    _mm_sfence();
+                } else {
+                    for (; i+8 <= n; i += 8)
+                        _mm256_storeu_ps(p+i, vv);
+                }
+            #elif defined(PHASESHIFT_SIMD_SSE2)
+                __m128 vv = _mm_set1_ps(v);
+                if (size_t(n)*sizeof(float) > stream_bytes_min) {
+                    for (; (i < n) && ((reinterpret_cast<uintptr_t>(p+i) & 15u) != 0); ++i)
+                        p[i] = v;
+                    for (; i+4 <= n; i += 4)
+                        _mm_stream_ps(p+i, vv);
+                    _mm_sfence();
+                } else {
+                    for (; i+4 <= n; i += 4)
+                        _mm_storeu_ps(p+i, vv);
+                }
+            #elif defined(PHASESHIFT_SIMD_NEON)
+                float32x4_t vv = vdupq_n_f32(v);
+                for (; i+4 <= n; i += 4)
+                    vst1q_f32(p+i, vv);
+            #endif
+            for (; i < n; ++i)
+                p[i] = v;
+        }
+
+        //! Bulk copy between non-overlapping buffers. Small copies defer to
+        //! memcpy; above stream_bytes_min the stores are non-temporal, so a
+        //! buffer-sized sweep does not evict the working set of downstream
+        //! consumers while the copied data would not fit in cache anyway.
+        inline void copy(void* PHASESHIFT_RESTRICT d, const void* PHASESHIFT_RESTRICT s, size_t bytes) {
+            #if defined(PHASESHIFT_SIMD_X86)
+                if (bytes > stream_bytes_min) {
+                    char* pd = static_cast<char*>(d);
+                    const char* ps = static_cast<const char*>(s);
+                    // Non-temporal stores require vector-aligned addresses
+                    const size_t head = (32u - (reinterpret_cast<uintptr_t>(pd) & 31u)) & 31u;
+                    std::memcpy(pd, ps, head);
+                    pd += head;
+                    ps += head;
+                    size_t left = bytes - head;
+                    for (; left >= 32u; left -= 32u, pd += 32, ps += 32)
+                        _mm256_stream_si256(reinterpret_cast<__m256i*>(pd),
+                                            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ps)));
+                    _mm_sfence();
+                    std::memcpy(pd, ps, left);
+                    return;
+                }
+            #elif defined(PHASESHIFT_SIMD_SSE2)
+                if (bytes > stream_bytes_min) {
+                    char* pd = static_cast<char*>(d);
+                    const char* ps = static_cast<const char*>(s);
+                    const size_t head = (16u - (reinterpret_cast<uintptr_t>(pd) & 15u)) & 15u;
+                    std::memcpy(pd, ps, head);
+                    pd += head;
+                    ps += head;
+                    size_t left = bytes - head;
+                    for (; left >= 16u; left -= 16u, pd += 16, ps += 16)
+                        _mm_stream_si128(reinterpret_cast<__m128i*>(pd),
+                                         _mm_loadu_si128(reinterpret_cast<const __m128i*>(ps)));
+                    _mm_sfence();
+                    std::memcpy(pd, ps, left);
+                    return;
+                }
+            #endif
+            std::memcpy(d, s, bytes);
+        }
+
+        //! Copy between vector-aligned float runs; both pointers must carry
+        //! the allocation alignment. Inline whole-vector moves instead of a
+        //! call into glibc's size-dispatched memcpy, whose dispatch overhead
+        //! is measurable against frame-sized copies. Runs beyond the
+        //! streaming threshold defer to copy() above.
+        inline void copy_aligned(float* PHASESHIFT_RESTRICT d, const float* PHASESHIFT_RESTRICT s, int n) {
+            if (size_t(n)*sizeof(float) > stream_bytes_min) {
+                copy(d, s, sizeof(float)*size_t(n));
+                return;
+            }
+            int i = 0;
+            #if defined(__AVX512F__)
+                for (; i+16 <= n; i += 16)
+                    _mm512_store_ps(d+i, _mm512_load_ps(s+i));
+            #elif defined(PHASESHIFT_SIMD_X86)
+                for (; i+8 <= n; i += 8)
+                    _mm256_store_ps(d+i, _mm256_load_ps(s+i));
+            #elif defined(PHASESHIFT_SIMD_SSE2)
+                for (; i+4 <= n; i += 4)
+                    _mm_store_ps(d+i, _mm_load_ps(s+i));
+            #elif defined(PHASESHIFT_SIMD_NEON)
+                for (; i+4 <= n; i += 4)
+                    vst1q_f32(d+i, vld1q_f32(s+i));
+            #endif
+            for (; i < n; ++i)
+                d[i] = s[i];
+        }
+
+        //! Narrow a double run into floats: one conversion per vector instead
+        //! of a per-element downcast.
+        inline void cvt(float* PHASESHIFT_RESTRICT d, const double* PHASESHIFT_RESTRICT s, int n) {
+            int i = 0;
+            #if defined(__AVX512F__)
+                for (; i+8 <= n; i += 8)
+                    _mm256_storeu_ps(d+i, _mm512_cvtpd_ps(_mm512_loadu_pd(s+i)));
+            #elif defined(PHASESHIFT_SIMD_X86)
+                for (; i+4 <= n; i += 4)
+                    _mm_storeu_ps(d+i, _mm256_cvtpd_ps(_mm256_loadu_pd(s+i)));
+            #elif defined(PHASESHIFT_SIMD_SSE2)
+                for (; i+4 <= n; i += 4) {
+                    __m128 lo = _mm_cvtpd_ps(_mm_loadu_pd(s+i));
+                    __m128 hi = _mm_cvtpd_ps(_mm_loadu_pd(s+i+2));
+                    _mm_storeu_ps(d+i, _mm_movelh_ps(lo, hi));
+                }
+            #elif defined(PHASESHIFT_SIMD_NEON) && defined(__aarch64__)
+                // float64x2_t needs AArch64, ARMv7 falls back to the scalar loop
+                for (; i+4 <= n; i += 4) {
+                    float32x2_t lo = vcvt_f32_f64(vld1q_f64(s+i));
+                    float32x2_t hi = vcvt_f32_f64(vld1q_f64(s+i+2));
+                    vst1q_f32(d+i, vcombine_f32(lo, hi));
+                }
+            #endif
+            for (; i < n; ++i)
+                d[i] = static_cast<float>(s[i]);
+        }
+
+        #if defined(PHASESHIFT_SIMD_X86) && defined(__AVX2__)
+        //! expf over 8 lanes: base-2 range reduction with the power of two
+        //! rebuilt through the exponent bits and a degree-5 minimax
+        //! polynomial (Cephes) for the fraction, same register-only style
+        //! as the cos/sin polynomial path in lookup_table.h. Accurate to
+        //! ~1e-7 relative over the clamped range, which covers all finite
+        //! float results.
+        inline __m256 exp_ps(__m256 x) {
+            const __m256 exp_hi = _mm256_set1_ps( 88.3762626647949f);
+            const __m256 exp_lo = _mm256_set1_ps(-88.3762626647949f);
+            const __m256 log2e = _mm256_set1_ps(1.44269504088896341f);
+            // ln(2) split in two constants so the reduction stays accurate
+            const __m256 c_ln2_hi = _mm256_set1_ps(0.693359375f);
+            const __m256 c_ln2_lo = _mm256_set1_ps(-2.12194440e-4f);
+            const __m256 p0 = _mm256_set1_ps(1.9875691500e-4f);
+            const __m256 p1 = _mm256_set1_ps(1.3981999507e-3f);
+            const __m256 p2 = _mm256_set1_ps(8.3334519073e-3f);
+            const __m256 p3 = _mm256_set1_ps(4.1665795894e-2f);
+            const __m256 p4 = _mm256_set1_ps(1.6666665459e-1f);
+            const __m256 p5 = _mm256_set1_ps(5.0000001201e-1f);
+            const __m256 one = _mm256_set1_ps(1.0f);
+
+            x = _mm256_max_ps(_mm256_min_ps(x, exp_hi), exp_lo);
+
+            // n = round(x/ln(2)), r = x - n*ln(2), exp(x) = 2^n * exp(r)
+            __m256 nf = _mm256_round_ps(_mm256_mul_ps(x, log2e), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+            __m256 r = _mm256_sub_ps(x, _mm256_mul_ps(nf, c_ln2_hi));
+            r = _mm256_sub_ps(r, _mm256_mul_ps(nf, c_ln2_lo));
+
+            __m256 r2 = _mm256_mul_ps(r, r);
+            __m256 p = p0;
+            p = _mm256_add_ps(_mm256_mul_ps(p, r), p1);
+            p = _mm256_add_ps(_mm256_mul_ps(p, r), p2);
+            p = _mm256_add_ps(_mm256_mul_ps(p, r), p3);
+            p = _mm256_add_ps(_mm256_mul_ps(p, r), p4);
+            p = _mm256_add_ps(_mm256_mul_ps(p, r), p5);
+            p = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(p, r2), r), one);
+
+            // 2^n through the float exponent field
+            __m256i n = _mm256_add_epi32(_mm256_cvtps_epi32(nf), _mm256_set1_epi32(127));
+            __m256 pow2n = _mm256_castsi256_ps(_mm256_slli_epi32(n, 23));
+            return _mm256_mul_ps(p, pow2n);
+        }
+
+        //! cosf over 8 lanes (Cephes): quadrant reduction against pi/4 with
+        //! the remainder rebuilt from a three-part pi split, then the sin or
+        //! cos minimax polynomial per lane depending on the octant. Accurate
+        //! to ~1 ulp for arguments within a few periods of zero, which is
+        //! the range the window generators feed it.
+        inline __m256 cos_ps(__m256 x) {
+            const __m256 four_over_pi = _mm256_set1_ps(1.27323954473516f);
+            // pi/4 split in three constants so the reduction stays accurate
+            const __m256 c_dp1 = _mm256_set1_ps(-0.78515625f);
+            const __m256 c_dp2 = _mm256_set1_ps(-2.4187564849853515625e-4f);
+            const __m256 c_dp3 = _mm256_set1_ps(-3.77489497744594108e-8f);
+            const __m256 s0 = _mm256_set1_ps(-1.9515295891e-4f);
+            const __m256 s1 = _mm256_set1_ps( 8.3321608736e-3f);
+            const __m256 s2 = _mm256_set1_ps(-1.6666654611e-1f);
+            const __m256 c0 = _mm256_set1_ps( 2.443315711809948e-5f);
+            const __m256 c1 = _mm256_set1_ps(-1.388731625493765e-3f);
+            const __m256 c2 = _mm256_set1_ps( 4.166664568298827e-2f);
+            const __m256 half = _mm256_set1_ps(0.5f);
+            const __m256 one = _mm256_set1_ps(1.0f);
+
+            x = _mm256_and_ps(x, _mm256_castsi256_ps(_mm256_set1_epi32(0x7fffffff)));  // cos(-x) = cos(x)
+
+            // Octant j = round-to-even-ish of x/(pi/4), shifted so each pair
+            // of octants shares one polynomial.
+            __m256i j = _mm256_cvttps_epi32(_mm256_mul_ps(x, four_over_pi));
+            j = _mm256_and_si256(_mm256_add_epi32(j, _mm256_set1_epi32(1)), _mm256_set1_epi32(~1));
+            __m256 y = _mm256_cvtepi32_ps(j);
+            j = _mm256_sub_epi32(j, _mm256_set1_epi32(2));
+
+            __m256 sign = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_andnot_si256(j, _mm256_set1_epi32(4)), 29));
+            __m256 poly_mask = _mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_and_si256(j, _mm256_set1_epi32(2)), _mm256_setzero_si256()));
+
+            // r = x - j*pi/4, extended precision
+            __m256 r = _mm256_add_ps(x, _mm256_mul_ps(y, c_dp1));
+            r = _mm256_add_ps(r, _mm256_mul_ps(y, c_dp2));
+            r = _mm256_add_ps(r, _mm256_mul_ps(y, c_dp3));
+
+            __m256 z = _mm256_mul_ps(r, r);
+            __m256 pc = c0;
+            pc = _mm256_add_ps(_mm256_mul_ps(pc, z), c1);
+            pc = _mm256_add_ps(_mm256_mul_ps(pc, z), c2);
+            pc = _mm256_mul_ps(_mm256_mul_ps(pc, z), z);
+            pc = _mm256_sub_ps(pc, _mm256_mul_ps(z, half));
+            pc = _mm256_add_ps(pc, one);
+            __m256 ps = s0;
+            ps = _mm256_add_ps(_mm256_mul_ps(ps, z), s1);
+            ps = _mm256_add_ps(_mm256_mul_ps(ps, z), s2);
+            ps = _mm256_add_ps(_mm256_mul_ps(_mm256_mul_ps(ps, z), r), r);
+
+            __m256 res = _mm256_or_ps(_mm256_andnot_ps(poly_mask, pc), _mm256_and_ps(poly_mask, ps));
+            return _mm256_xor_ps(res, sign);
+        }
+        #endif
+
+        #if defined(PHASESHIFT_SIMD_NEON) && defined(__aarch64__)
+        //! expf over 4 lanes: same reduction and polynomial as the AVX2
+        //! exp_ps above. AArch64 only (vrndnq), ARMv7 keeps libm expf.
+        inline float32x4_t exp_ps(float32x4_t x) {
+            const float32x4_t exp_hi = vdupq_n_f32( 88.3762626647949f);
+            const float32x4_t exp_lo = vdupq_n_f32(-88.3762626647949f);
+            const float32x4_t log2e = vdupq_n_f32(1.44269504088896341f);
+            // ln(2) split in two constants so the reduction stays accurate
+            const float32x4_t c_ln2_hi = vdupq_n_f32(0.693359375f);
+            const float32x4_t c_ln2_lo = vdupq_n_f32(-2.12194440e-4f);
+            const float32x4_t p0 = vdupq_n_f32(1.9875691500e-4f);
+            const float32x4_t p1 = vdupq_n_f32(1.3981999507e-3f);
+            const float32x4_t p2 = vdupq_n_f32(8.3334519073e-3f);
+            const float32x4_t p3 = vdupq_n_f32(4.1665795894e-2f);
+            const float32x4_t p4 = vdupq_n_f32(1.6666665459e-1f);
+            const float32x4_t p5 = vdupq_n_f32(5.0000001201e-1f);
+            const float32x4_t one = vdupq_n_f32(1.0f);
+
+            x = vmaxq_f32(vminq_f32(x, exp_hi), exp_lo);
+
+            // n = round(x/ln(2)), r = x - n*ln(2), exp(x) = 2^n * exp(r)
+            float32x4_t nf = vrndnq_f32(vmulq_f32(x, log2e));
+            float32x4_t r = vfmsq_f32(x, nf, c_ln2_hi);
+            r = vfmsq_f32(r, nf, c_ln2_lo);
+
+            float32x4_t r2 = vmulq_f32(r, r);
+            float32x4_t p = p0;
+            p = vfmaq_f32(p1, p, r);
+            p = vfmaq_f32(p2, p, r);
+            p = vfmaq_f32(p3, p, r);
+            p = vfmaq_f32(p4, p, r);
+            p = vfmaq_f32(p5, p, r);
+            p = vaddq_f32(vfmaq_f32(r, p, r2), one);
+
+            // 2^n through the float exponent field
+            int32x4_t n = vaddq_s32(vcvtq_s32_f32(nf), vdupq_n_s32(127));
+            float32x4_t pow2n = vreinterpretq_f32_s32(vshlq_n_s32(n, 23));
+            return vmulq_f32(p, pow2n);
+        }
+        #endif
+
+    }  // namespace simd
+}  // namespace phaseshift
+
+#endif  // PHASESHIFT_SIMD_H_
@@ -7,14 +7,30 @@
 
 #include <phaseshift/utils.h>
 
+std::atomic<bool> phaseshift::dev::g_debug_enabled{true};
+
 #ifdef __ANDROID__
     phaseshift::debug_stream_android_t phaseshift::g_debug_stream_android;
 #endif
 
-int phaseshift::music_note_to_semitone(const std::string& note) {
+int phaseshift::music_note_to_semitone(std::string_view note) {
     assert(note.size() > 0);
     assert(note.size() <= 2);
 
+    // Semitone per (key, accidental): one table load replaces the dozen
+    // compare/branch pairs of the former if-chain. -1 marks the spellings
+    // that chain rejected (B#, Cb, E#, Fb).
+    static constexpr int8_t semitones[7*3] = {
+    //  none   #    b
+         9,   10,   8,   // A
+        11,   -1,  10,   // B
+         0,    1,  -1,   // C
+         2,    3,   1,   // D
+         4,   -1,   3,   // E
+         5,    6,  -1,   // F
+         7,    8,   6,   // G
+    };
+
     char note_key = note[0];
     char note_accidental = '\0';
     if (note.size() > 1) {
@@ -28,35 +44,18 @@ int phaseshift::music_note_to_semitone(const std::string& note) {
         note_accidental = static_cast<char>(std::tolower(note_accidental));
     }
 
-    if (note_key == 'C' && note_accidental == '\0') {
-        return 0;
-    } else if ((note_key == 'C' && note_accidental == '#') || (note_key == 'D' && note_accidental == 'b')) {
-        return 1;
-    } else if (note_key == 'D' && note_accidental == '\0') {
-        return 2;
-    } else if ((note_key == 'D' && note_accidental == '#') || (note_key == 'E' && note_accidental == 'b')) {
-        return 3;
-    } else if (note_key == 'E' && note_accidental == '\0') {
-        return 4;
-    } else if (note_key == 'F' && note_accidental == '\0') {
-        return 5;
-    } else if ((note_key == 'F' && note_accidental == '#') || (note_key == 'G' && note_accidental == 'b')) {
-        return 6;
-    } else if (note_key == 'G' && note_accidental == '\0') {
-        return 7;
-    } else if ((note_key == 'G' && note_accidental == '#') || (note_key == 'A' && note_accidental == 'b')) {
-        return 8;
-    } else if (note_key == 'A' && note_accidental == '\0') {
-        return 9;
-    } else if ((note_key == 'A' && note_accidental == '#') || (note_key == 'B' && note_accidental == 'b')) {
-        return 10;
-    } else if (note_key == 'B' && note_accidental == '\0') {
-        return 11;
+    const int key_idx = note_key - 'A';
+    const int acc_idx = (note_accidental == '\0') ? 0
+                      : (note_accidental == '#') ? 1
+                      : (note_accidental == 'b') ? 2 : -1;
+    if ((key_idx < 0) || (key_idx >= 7) || (acc_idx < 0)) {
+        assert(false && "phaseshift::music_note_to_semitone: Invalid note");
+        return -1;  // -1 could be a semitone number, but it can't be returned by any other cases, so use it as an invalid value here.
     }
 
-    assert(false && "phaseshift::music_note_to_semitone: Invalid note");
-
-    return -1;  // -1 could be a semitone number, but it can't be returned by any other cases, so use it as an invalid value here.
+    const int semitone = semitones[key_idx*3 + acc_idx];
+    assert((semitone >= 0) && "phaseshift::music_note_to_semitone: Invalid note");
+    return semitone;
 }
 
 int phaseshift::dev::check_compilation_options() {
@@ -77,6 +76,16 @@ int phaseshift::dev::check_compilation_options() {
     std::cerr << "WARNING: phaseshift library: Profiling is enabled. Extra time might be spent in measuring some function calls (ex. audio_block::proc(.)). (PHASESHIFT_DEV_PROFILING=ON)" << std::endl;
     #endif
 
+    #ifdef PHASESHIFT_SIMD_RCP_DIV
+    ret++;
+    std::cerr << "WARNING: phaseshift library: Element-wise division uses a refined reciprocal estimate. Results are not bit-exact wrt IEEE division. (PHASESHIFT_SIMD_RCP_DIV=ON)" << std::endl;
+    #endif
+
+    #ifdef PHASESHIFT_ENABLE_OMP
+    ret++;
+    std::cerr << "WARNING: phaseshift library: Element-wise kernels thread with OpenMP on long buffers. Unsuited to real-time audio paths. (PHASESHIFT_ENABLE_OMP=ON)" << std::endl;
+    #endif
+
     // Supress warnings
     (void)phaseshift::twopi;
     (void)phaseshift::oneover_twopi;
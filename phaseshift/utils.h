@@ -13,26 +13,71 @@
 #endif
 #include <cmath>
 
-#include <random>
 #include <limits>
 #include <complex>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <type_traits>
+// Included by nearly every translation unit, so only what this header uses
+// itself: <iostream> stays for the std::cerr diagnostics of the debug macros
+// and the dev:: checks; <random>, <fstream>, <chrono>, <thread> and
+// <iomanip> moved to the files that actually use them.
 #include <iostream>
-#include <fstream>
-#include <sstream>
 #include <cassert>
-#include <chrono>
-#include <thread>
-#include <ctime>
-#include <iomanip>
+#include <atomic>
 
-#include "./filesystem.h"
+#if defined(__AVX512F__) || defined(__AVX2__)
+    #include <immintrin.h>  // AVX2/AVX-512 paths of the dev:: signal reductions below
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+    #include <arm_neon.h>  // NEON paths of the same reductions
+#endif
+
+namespace phaseshift {
+    //! Compile-time basename of a path literal, for DFILE__: the former
+    //! std::filesystem::path round-trip parsed and heap-allocated on every
+    //! DLINE/DOUT, and pulled <filesystem> into every translation unit.
+    constexpr const char* basename_ce(const char* path) {
+        const char* file = path;
+        for (const char* s = path; *s; ++s)
+            if (*s == '/' || *s == '\\')
+                file = s+1;
+        return file;
+    }
+
+    //! Finite iff the exponent field is not all ones: one and+cmp covers
+    //! NaN and Inf together, where the isnan+isinf pair of the former
+    //! assert_nan_inf classified the value twice.
+    inline bool is_finite_bits(float value) {
+        uint32_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        return (bits & 0x7f800000u) != 0x7f800000u;
+    }
+    inline bool is_finite_bits(double value) {
+        uint64_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        return (bits & 0x7ff0000000000000ull) != 0x7ff0000000000000ull;
+    }
+
+    namespace dev {
+        //! Runtime switch for the DLINE/DOUT macros. On by default; a host
+        //! that wants them silenced flips it once and every suppressed line
+        //! costs a relaxed load and one predictable branch, with none of the
+        //! stream formatting evaluated.
+        extern std::atomic<bool> g_debug_enabled;
+    }
+}
 
-#define DFILE__ std::filesystem::path(__FILE__).filename().string()  // Only filename
+#define DFILE__ phaseshift::basename_ce(__FILE__)  // Only filename
 // #define DFILE__ __FILE__  // For full path
 
 #ifdef __ANDROID__
     #include <android/log.h>
-    #define DLINETAG(CHANNEL_NAME) { __android_log_print(ANDROID_LOG_INFO, CHANNEL_NAME, "%s:%d", std::string(__FILE__).substr(std::string(__FILE__).find_last_of("/\\")+1).c_str(), __LINE__); }
+    #include <sstream>  // rare-type fallback of the debug stream below
+    #define DLINETAG(CHANNEL_NAME) if (!phaseshift::dev::g_debug_enabled.load(std::memory_order_relaxed)) {} else { __android_log_print(ANDROID_LOG_INFO, CHANNEL_NAME, "%s:%d", DFILE__, __LINE__); }
 
     namespace phaseshift {
 
@@ -41,15 +86,51 @@
             std::string m_filename;
             std::string m_channel_name;
             int m_line;
-            std::stringstream m_stringstream;
+            // Inline buffer in place of the former std::stringstream:
+            // appending through snprintf skips the locale facet lookup and
+            // the virtual num_put dispatch of the stream, and messages
+            // shorter than the buffer never touch the heap. Longer messages
+            // are truncated, which a debug log can afford.
+            char m_buf[512];
+            int m_size = 0;
             debug_stream_android_t& set_filename(const std::string& filename) { m_filename = filename; return *this; }
             debug_stream_android_t& set_channel_name(const std::string& channel_name) { m_channel_name = channel_name; return *this; }
             debug_stream_android_t& set_line(int line) { m_line = line; return *this; }
+            void append(const char* p, int len) {
+                if (len > static_cast<int>(sizeof(m_buf)) - m_size)
+                    len = static_cast<int>(sizeof(m_buf)) - m_size;
+                if (len <= 0) return;
+                std::memcpy(m_buf + m_size, p, len);
+                m_size += len;
+            }
         };
 
         template<typename value_type>
         debug_stream_android_t& operator<<(debug_stream_android_t& debug_stream, const value_type& v) {
-            debug_stream.m_stringstream << v;
+            if constexpr (std::is_same_v<value_type, char>) {
+                debug_stream.append(&v, 1);
+            } else if constexpr (std::is_same_v<value_type, bool>) {
+                debug_stream.append(v ? "1" : "0", 1);
+            } else if constexpr (std::is_integral_v<value_type>) {
+                char tmp[24];
+                debug_stream.append(tmp, std::snprintf(tmp, sizeof(tmp), "%lld", static_cast<long long>(v)));
+            } else if constexpr (std::is_floating_point_v<value_type>) {
+                char tmp[40];
+                debug_stream.append(tmp, std::snprintf(tmp, sizeof(tmp), "%g", static_cast<double>(v)));
+            } else if constexpr (std::is_convertible_v<value_type, const char*>) {
+                const char* str = v;
+                debug_stream.append(str, static_cast<int>(std::strlen(str)));
+            } else if constexpr (std::is_convertible_v<value_type, std::string>) {
+                const std::string str = v;
+                debug_stream.append(str.data(), static_cast<int>(str.size()));
+            } else {
+                // Rare types (complex, custom operator<<): one stack stream,
+                // off the common path.
+                std::ostringstream oss;
+                oss << v;
+                const std::string str = oss.str();
+                debug_stream.append(str.data(), static_cast<int>(str.size()));
+            }
             return debug_stream;
         }
 
@@ -58,10 +139,10 @@
                 fn == static_cast<std::ostream& (*)(std::ostream&)>(std::endl) ||
                 fn == static_cast<std::ostream& (*)(std::ostream&)>(std::flush)
             ) {
-                __android_log_print(ANDROID_LOG_INFO, debug_stream.m_channel_name.c_str(), "%s:%d: %s", debug_stream.m_filename.c_str(), debug_stream.m_line, debug_stream.m_stringstream.str().c_str());
-                // std::cerr << debug_stream.m_filename << ":" << debug_stream.m_line << ": " << debug_stream.m_stringstream.str() << std::endl;
+                __android_log_print(ANDROID_LOG_INFO, debug_stream.m_channel_name.c_str(), "%s:%d: %.*s", debug_stream.m_filename.c_str(), debug_stream.m_line, debug_stream.m_size, debug_stream.m_buf);
+                // std::cerr << debug_stream.m_filename << ":" << debug_stream.m_line << ": " << std::string(debug_stream.m_buf, debug_stream.m_size) << std::endl;
 
-                debug_stream.m_stringstream.str(std::string());
+                debug_stream.m_size = 0;
             }
 
             return debug_stream;
@@ -70,11 +151,14 @@
         extern debug_stream_android_t g_debug_stream_android;  // here static will create a copy for each translation unit.
     }
 
-    #define DOUTTAG(CHANNEL_NAME) phaseshift::g_debug_stream_android.set_filename(DFILE__).set_line(__LINE__).set_channel_name(CHANNEL_NAME)
+    #define DOUTTAG(CHANNEL_NAME) if (!phaseshift::dev::g_debug_enabled.load(std::memory_order_relaxed)) {} else phaseshift::g_debug_stream_android.set_filename(DFILE__).set_line(__LINE__).set_channel_name(CHANNEL_NAME)
 
 #else
-    #define DLINETAG(CHANNEL_NAME) std::cerr << CHANNEL_NAME << ": " << DFILE__ << ":" << __LINE__ << std::endl;
-    #define DOUTTAG(CHANNEL_NAME) std::cerr << CHANNEL_NAME << ": " << DFILE__ << ":" << __LINE__ << ": "
+    // The if/else form (instead of a plain if) keeps the trailing stream
+    // chain of `DOUT << ...;` inside the gate without swallowing a
+    // following else at the call site.
+    #define DLINETAG(CHANNEL_NAME) if (!phaseshift::dev::g_debug_enabled.load(std::memory_order_relaxed)) {} else std::cerr << CHANNEL_NAME << ": " << DFILE__ << ":" << __LINE__ << std::endl;
+    #define DOUTTAG(CHANNEL_NAME) if (!phaseshift::dev::g_debug_enabled.load(std::memory_order_relaxed)) {} else std::cerr << CHANNEL_NAME << ": " << DFILE__ << ":" << __LINE__ << ": "
 #endif
 
 #define DLINE DLINETAG("debug")
@@ -87,34 +171,192 @@
     #define PHASESHIFT_PROF(X)
 #endif
 
-#define assert_nan_inf(value) {assert(!std::isnan(value) && "value is nan"); assert(!std::isinf(value) && "value is inf");}
+#define assert_nan_inf(value) assert(phaseshift::is_finite_bits(value) && "value is nan or inf")
+
+// Portable no-aliasing qualifier for hot loop pointers.
+#if defined(_MSC_VER)
+    #define PHASESHIFT_RESTRICT __restrict
+#else
+    #define PHASESHIFT_RESTRICT __restrict__
+#endif
+
+// Mark a function as a hot spot: the compiler optimizes it more aggressively
+// and groups it with the other hot functions in the text section.
+#if defined(__GNUC__)
+    #define PHASESHIFT_HOT __attribute__((hot))
+#else
+    #define PHASESHIFT_HOT
+#endif
+
+// Force inlining of tiny per-sample callees whose call overhead would rival
+// their body. Replaces the inline keyword; combine with PHASESHIFT_HOT.
+#if defined(_MSC_VER)
+    #define PHASESHIFT_ALWAYS_INLINE __forceinline
+#elif defined(__GNUC__)
+    #define PHASESHIFT_ALWAYS_INLINE inline __attribute__((always_inline))
+#else
+    #define PHASESHIFT_ALWAYS_INLINE inline
+#endif
+
+// Branch prediction hints for data-dependent branches whose skew is known
+// (e.g. the ring content is continuous far more often than it wraps): the
+// hinted path is laid out on the fall-through side, next in the I-cache.
+#if defined(__GNUC__)
+    #define PHASESHIFT_LIKELY(x) __builtin_expect(!!(x), 1)
+    #define PHASESHIFT_UNLIKELY(x) __builtin_expect(!!(x), 0)
+#else
+    #define PHASESHIFT_LIKELY(x) (x)
+    #define PHASESHIFT_UNLIKELY(x) (x)
+#endif
+
+// Promise the compiler a loop carries no dependency, so it can vectorize it
+// without adding a runtime aliasing check.
+#if defined(__clang__)
+    #define PHASESHIFT_IVDEP _Pragma("clang loop vectorize(enable)")
+#elif defined(__GNUC__)
+    #define PHASESHIFT_IVDEP _Pragma("GCC ivdep")
+#else
+    #define PHASESHIFT_IVDEP
+#endif
+
+// constexpr where the standard library provides constexpr <cmath>
+// (__cpp_lib_constexpr_cmath, C++26): conversions of literal dB thresholds
+// then fold at compile time; plain inline everywhere else.
+#if defined(__cpp_lib_constexpr_cmath) && (__cpp_lib_constexpr_cmath >= 202306L)
+    #define PHASESHIFT_CONSTEXPR_CMATH constexpr
+#else
+    #define PHASESHIFT_CONSTEXPR_CMATH inline
+#endif
 
 namespace phaseshift {
 
-    inline float lin2db(float value) {
-        return 20.0f*log10f(fabsf(value));
+    // Base-change factors folded at compile time: logf/expf skip the
+    // argument normalization that the generic log10f/powf entry points pay,
+    // for the same result up to rounding.
+    static constexpr float k_20_over_ln10 = 8.6858896380650365f;
+    static constexpr float k_10_over_ln10 = 4.3429448190325182f;
+    static constexpr float k_ln10_over_20 = 0.1151292546497023f;
+
+    PHASESHIFT_CONSTEXPR_CMATH float lin2db(float value) {
+        return k_20_over_ln10*logf(fabsf(value));
     }
-    inline float db2lin(float value) {
-        return powf(10.0f, value*0.05f);  // 0.05=1.0/20.0
+    PHASESHIFT_CONSTEXPR_CMATH float db2lin(float value) {
+        return expf(value*k_ln10_over_20);
     }
-    inline float lin2db(std::complex<float> value) {
-        return 10.0f*log10f(std::norm(value));
+    PHASESHIFT_CONSTEXPR_CMATH float lin2db(std::complex<float> value) {
+        return k_10_over_ln10*logf(std::norm(value));
     }
 
     template<typename T>
-    T lin2db(T value) {
+    PHASESHIFT_CONSTEXPR_CMATH T lin2db(T value) {
         return static_cast<T>(20.0)*std::log10(std::abs(value));
     }
     template<typename T>
-    T db2lin(T value) {
+    PHASESHIFT_CONSTEXPR_CMATH T db2lin(T value) {
         return std::pow(static_cast<T>(10.0), value*static_cast<T>(0.05));  // 0.05=1.0/20.0
     }
 
+    //! |x| as a plain clear of the sign bit. std::abs promotes to double
+    //! under some deduced-type call sites and can end up as a libm call;
+    //! this form is always a single and against 0x7fffffff.
+    PHASESHIFT_ALWAYS_INLINE float fabsf_bits(float value) {
+        uint32_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        bits &= 0x7fffffffu;
+        std::memcpy(&value, &bits, sizeof(value));
+        return value;
+    }
+
+    //! lin2db without the log10f call: the exponent comes straight from the
+    //! float bits and the mantissa term from a rational correction. Within
+    //! ~0.002 dB of lin2db on normal floats; zero and denormals return about
+    //! -760 dB instead of -inf, NaN/Inf are not handled. For displays,
+    //! thresholds and other places where a millibel does not matter.
+    inline float lin2db_approx(float value) {
+        uint32_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        bits &= 0x7fffffffu;  // |value|
+        uint32_t mbits = (bits & 0x007fffffu) | 0x3f000000u;  // mantissa in [0.5,1)
+        float m;
+        std::memcpy(&m, &mbits, sizeof(m));
+        // log2(value) with the mantissa correction folded in, then scaled by
+        // 20*log10(2)
+        float log2v = bits * 1.1920928955078125e-7f
+                      - 124.22551499f - 1.498030302f*m - 1.72587999f/(0.3520887068f + m);
+        return 6.02059991327962f * log2v;
+    }
+
+    //! db2lin without the powf call: 2^(value*log2(10)/20) with the integer
+    //! part of the exponent rebuilt through the float exponent field and a
+    //! rational correction for the fraction. Within ~2e-4 relative of
+    //! db2lin; same accuracy register as lin2db_approx above.
+    inline float db2lin_approx(float value) {
+        float p = value * 0.16609640474436813f;  // log2(10)/20
+        if (p < -126.0f)  p = -126.0f;  // flush below the normal range to 0
+        const int w = static_cast<int>(p);
+        const float z = p - w + ((p < 0.0f) ? 1.0f : 0.0f);
+        const uint32_t bits = static_cast<uint32_t>(
+            (1 << 23) * (p + 121.2740575f + 27.7280233f/(4.84252568f - z) - 1.49012907f*z));
+        float result;
+        std::memcpy(&result, &bits, sizeof(result));
+        return result;
+    }
+
+    //! Batched lin2db_approx: same formula as the scalar version, 8 lanes
+    //! per iteration, for conversion-heavy paths that map whole buffers to
+    //! dB (libm log10f costs more than the full 8-lane block). in and out
+    //! may alias. Same accuracy and zero/NaN/Inf limits as the scalar.
+    inline void lin2db_approx(const float* in, float* out, int size) {
+        int n = 0;
+        #if defined(__AVX2__)
+            const __m256i absmask = _mm256_set1_epi32(0x7fffffff);
+            const __m256i mantmask = _mm256_set1_epi32(0x007fffff);
+            const __m256i halfexp = _mm256_set1_epi32(0x3f000000);
+            for (; n+8 <= size; n += 8) {
+                __m256i bits = _mm256_and_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(in+n)), absmask);
+                __m256 m = _mm256_castsi256_ps(_mm256_or_si256(_mm256_and_si256(bits, mantmask), halfexp));
+                __m256 r = _mm256_sub_ps(_mm256_mul_ps(_mm256_cvtepi32_ps(bits), _mm256_set1_ps(1.1920928955078125e-7f)),
+                                         _mm256_set1_ps(124.22551499f));
+                r = _mm256_sub_ps(r, _mm256_mul_ps(_mm256_set1_ps(1.498030302f), m));
+                r = _mm256_sub_ps(r, _mm256_div_ps(_mm256_set1_ps(1.72587999f), _mm256_add_ps(_mm256_set1_ps(0.3520887068f), m)));
+                _mm256_storeu_ps(out+n, _mm256_mul_ps(_mm256_set1_ps(6.02059991327962f), r));
+            }
+        #endif
+        for (; n < size; ++n)
+            out[n] = lin2db_approx(in[n]);
+    }
+
+    //! Batched db2lin_approx; see lin2db_approx above.
+    inline void db2lin_approx(const float* in, float* out, int size) {
+        int n = 0;
+        #if defined(__AVX2__)
+            const __m256 scale = _mm256_set1_ps(0.16609640474436813f);
+            const __m256 pmin = _mm256_set1_ps(-126.0f);
+            const __m256 one = _mm256_set1_ps(1.0f);
+            for (; n+8 <= size; n += 8) {
+                __m256 p = _mm256_max_ps(_mm256_mul_ps(_mm256_loadu_ps(in+n), scale), pmin);
+                __m256 w = _mm256_cvtepi32_ps(_mm256_cvttps_epi32(p));
+                __m256 z = _mm256_sub_ps(p, w);
+                z = _mm256_add_ps(z, _mm256_and_ps(one, _mm256_cmp_ps(p, _mm256_setzero_ps(), _CMP_LT_OQ)));
+                __m256 e = _mm256_add_ps(p, _mm256_set1_ps(121.2740575f));
+                e = _mm256_add_ps(e, _mm256_div_ps(_mm256_set1_ps(27.7280233f), _mm256_sub_ps(_mm256_set1_ps(4.84252568f), z)));
+                e = _mm256_sub_ps(e, _mm256_mul_ps(_mm256_set1_ps(1.49012907f), z));
+                __m256i bits = _mm256_cvttps_epi32(_mm256_mul_ps(e, _mm256_set1_ps(static_cast<float>(1 << 23))));
+                _mm256_storeu_ps(out+n, _mm256_castsi256_ps(bits));
+            }
+        #endif
+        for (; n < size; ++n)
+            out[n] = db2lin_approx(in[n]);
+    }
+
     inline float coef2st(float coef) {
-        return 12.0f * std::log2(coef);
+        return 12.0f * log2f(coef);
     }
     inline float st2coef(float st) {
-        return std::pow(2.0f, st / 12.0f);
+        // exp2f skips the generic pow dispatch that std::pow(2.0f, .) can
+        // go through, and the reciprocal folds at compile time.
+        static constexpr float inv12 = 1.0f/12.0f;
+        return exp2f(st * inv12);
     }
     inline float hz2st(float hz, float A4 = 440.0f) {
         return coef2st(hz / A4);
@@ -125,11 +367,24 @@ namespace phaseshift {
 
     //! Convert a music note to a semitone number relative to 'C'
     //    Recognizes C, C#, Db, D, D#, Eb, E, F, F#, Gb, G, G#, Ab, A, A#, Bb, B
-    int music_note_to_semitone(const std::string& note);
+    //    string_view: the usual literal call sites bind without building a
+    //    std::string (std::string arguments still convert implicitly).
+    int music_note_to_semitone(std::string_view note);
 
-    inline int nextpow2(int winlen) {  // TODO(GD) Move to fftscarf
+    constexpr int nextpow2(int winlen) {  // TODO(GD) Move to fftscarf
         assert(winlen > 0);
-        int dftlen = static_cast<int>(std::pow<int>(2, static_cast<int>(std::ceil(std::log2f(static_cast<float>(winlen))))));
+        // Smallest power of two >= winlen from the leading-zero count:
+        // exact for the whole int range, where log2f/pow went through
+        // float rounding. constexpr, so a compile-time winlen folds away.
+        #if defined(__GNUC__)
+            int dftlen = (winlen <= 1) ? 1 : 1 << (32 - __builtin_clz(static_cast<unsigned>(winlen)-1u));
+        #else
+            // No constexpr-usable bit scan on MSVC: the shift loop still
+            // beats the former log2f/pow pair and folds just as well.
+            int dftlen = 1;
+            while (dftlen < winlen)
+                dftlen <<= 1;
+        #endif
         assert(dftlen >= winlen);
         assert(dftlen < 2*winlen);
         return dftlen;
@@ -154,6 +409,12 @@ namespace phaseshift {
             }
         }
 
+        //! Detect containers exposing contiguous storage through .data()
+        template<typename T, typename = void>
+        struct has_contiguous_data : std::false_type {};
+        template<typename T>
+        struct has_contiguous_data<T, std::void_t<decltype(std::declval<const T&>().data())>> : std::true_type {};
+
         template<class datastruct_ref, class datastruct_test>
         bool signals_equal_strictly(const datastruct_ref& ref, const datastruct_test& test, double threshold = std::numeric_limits<float>::epsilon()) {
             if (int(ref.size()) != int(test.size())) {
@@ -161,10 +422,38 @@ namespace phaseshift {
                 return false;
             }
 
-            for(int n=0; n<int(ref.size()); ++n) {
-                // DOUT << phaseshift::lin2db((ref[n] - test[n])) << "<" << phaseshift::lin2db(threshold) << std::endl;
+            int n = 0;
+            #if defined(__AVX2__)
+                if constexpr (has_contiguous_data<datastruct_ref>::value && has_contiguous_data<datastruct_test>::value
+                              && std::is_same_v<typename datastruct_ref::value_type, float>
+                              && std::is_same_v<typename datastruct_test::value_type, float>) {
+                    const float* pref = ref.data();
+                    const float* ptest = test.data();
+                    const int size = static_cast<int>(ref.size());
+                    // Rounded one step down so the vector compare can only
+                    // over-flag: any flagged vector is rechecked per lane
+                    // against the exact double threshold below. The compare
+                    // stays on the signed diff, as in the scalar loop.
+                    const __m256 vth = _mm256_set1_ps(std::nextafterf(static_cast<float>(threshold), -std::numeric_limits<float>::infinity()));
+                    for (; n+8 <= size; n += 8) {
+                        __m256 d = _mm256_sub_ps(_mm256_loadu_ps(pref+n), _mm256_loadu_ps(ptest+n));
+                        if (_mm256_movemask_ps(_mm256_cmp_ps(d, vth, _CMP_GT_OQ))) {
+                            for (int l = n; l < n+8; ++l) {
+                                if ((ref[l] - test[l]) > threshold) {
+                                    // approx is plenty for a diagnostic print
+                                    std::cerr << "ref[" << l << "]=" << ref[l] << " test[" << l << "]=" << test[l] << " err=" << (ref[l]-test[l]) << "(" << phaseshift::lin2db_approx(ref[l]-test[l]) << "dB) > " << threshold << "(" << phaseshift::lin2db_approx(threshold) << "dB)" << std::endl;
+                                    return false;
+                                }
+                            }
+                        }
+                    }
+                }
+            #endif
+            for(; n<int(ref.size()); ++n) {
+                // DOUT << phaseshift::lin2db_approx((ref[n] - test[n])) << "<" << phaseshift::lin2db_approx(threshold) << std::endl;
                 if ((ref[n] - test[n]) > threshold) {
-                    std::cerr << "ref[" << n << "]=" << ref[n] << " test[" << n << "]=" << test[n] << " err=" << (ref[n]-test[n]) << "(" << phaseshift::lin2db(ref[n]-test[n]) << "dB) > " << threshold << "(" << phaseshift::lin2db(threshold) << "dB)" << std::endl;
+                    // approx is plenty for a diagnostic print
+                    std::cerr << "ref[" << n << "]=" << ref[n] << " test[" << n << "]=" << test[n] << " err=" << (ref[n]-test[n]) << "(" << phaseshift::lin2db_approx(ref[n]-test[n]) << "dB) > " << threshold << "(" << phaseshift::lin2db_approx(threshold) << "dB)" << std::endl;
                     return false;
                 }
             }
@@ -172,46 +461,248 @@ namespace phaseshift {
             return true;
         }
 
+        struct diff_stats {
+            double rms;     //!< sqrt(mean((ref-test)^2)); -1.0 on ill-formed input
+            float max_abs;  //!< max |ref-test|; -1.0f on length mismatch
+        };
+
+        //! Pointer core of the diff statistics: straight contiguous float
+        //! buffers, no container indirection, restrict-qualified so the
+        //! kernel needs no aliasing checks.
+        PHASESHIFT_HOT inline diff_stats signals_diff_stats(const float* PHASESHIFT_RESTRICT ref, const float* PHASESHIFT_RESTRICT test, size_t size) {
+            assert(size > 0);
+            #if defined(PHASESHIFT_ENABLE_OMP) && defined(_OPENMP)
+                // Past the LLC the single-core sweep saturates one memory
+                // channel only: split across the team and re-enter the
+                // serial kernel per chunk (chunks sit below the threshold,
+                // so the recursion cannot nest the parallelism). The mean
+                // squares recombine exactly from the per-chunk RMS; the max
+                // reduction is order-free.
+                static constexpr size_t parallel_size_min = 512*1024/sizeof(float);  // same floor as the simd kernels
+                if (size >= 2*parallel_size_min) {
+                    const int nbchunks = static_cast<int>((size + parallel_size_min-1)/parallel_size_min);
+                    double ener = 0.0;
+                    float maxv = 0.0f;
+                    #pragma omp parallel for schedule(static) reduction(+:ener) reduction(max:maxv)
+                    for (int c = 0; c < nbchunks; ++c) {
+                        const size_t off = size_t(c)*parallel_size_min;
+                        const size_t len = std::min(parallel_size_min, size-off);
+                        const diff_stats chunk = signals_diff_stats(ref+off, test+off, len);
+                        ener += chunk.rms*chunk.rms*static_cast<double>(len);
+                        maxv = std::max(maxv, chunk.max_abs);
+                    }
+                    return {std::sqrt(ener/static_cast<double>(size)), maxv};
+                }
+            #endif
+            const int isize = static_cast<int>(size);
+            double ener = 0.0;
+            double comp = 0.0;  // Kahan compensation of the block sums
+            float maxv = 0.0f;
+            int n = 0;
+            #if defined(__AVX512F__)
+                // 16-lane tier of the tiled reduction below: same L1-sized
+                // tiles, double accumulators and Kahan fold, twice the
+                // elements per iteration. The high half extraction goes
+                // through extractf64x4 so AVX512F alone suffices (no DQ).
+                static constexpr int block = 8192;  // 32 KB of floats
+                __m512 mx0 = _mm512_setzero_ps();
+                __m512 mx1 = _mm512_setzero_ps();
+                while (n+16 <= isize) {
+                    const int bend = std::min(n + block, isize - (isize & 15));
+                    __m512d sq0 = _mm512_setzero_pd();
+                    __m512d sq1 = _mm512_setzero_pd();
+                    for (; n+16 <= bend; n += 16) {
+                        if ((n & 63) == 0) {
+                            // Comparisons often run on buffers the caller
+                            // just produced and that already left the near
+                            // caches; stay 16 lines ahead of both streams.
+                            _mm_prefetch(reinterpret_cast<const char*>(ref+n+256), _MM_HINT_NTA);
+                            _mm_prefetch(reinterpret_cast<const char*>(test+n+256), _MM_HINT_NTA);
+                        }
+                        __m512 d = _mm512_sub_ps(_mm512_loadu_ps(ref+n), _mm512_loadu_ps(test+n));
+                        __m512d dlo = _mm512_cvtps_pd(_mm512_castps512_ps256(d));
+                        __m512d dhi = _mm512_cvtps_pd(_mm256_castpd_ps(_mm512_extractf64x4_pd(_mm512_castps_pd(d), 1)));
+                        sq0 = _mm512_fmadd_pd(dlo, dlo, sq0);
+                        sq1 = _mm512_fmadd_pd(dhi, dhi, sq1);
+                        mx0 = _mm512_max_ps(mx0, _mm512_abs_ps(d));
+                        std::swap(mx0, mx1);
+                    }
+                    const double bsum = _mm512_reduce_add_pd(_mm512_add_pd(sq0, sq1));
+                    const double y = bsum - comp;
+                    const double t = ener + y;
+                    comp = (t - ener) - y;
+                    ener = t;
+                }
+                maxv = _mm512_reduce_max_ps(_mm512_max_ps(mx0, mx1));
+            #elif defined(__AVX2__)
+                // The squares accumulate in double lanes, per L1-sized tile:
+                // within a tile the double accumulators keep full
+                // significance, and the tile sums are Kahan-folded into the
+                // running total so multi-minute signals (N in the hundreds
+                // of millions) do not lose the small late terms. The max
+                // chains carry no rounding and run across the whole sweep.
+                static constexpr int block = 8192;  // 32 KB of floats
+                const __m256 signmask = _mm256_set1_ps(-0.0f);
+                __m256 mx0 = _mm256_setzero_ps();
+                __m256 mx1 = _mm256_setzero_ps();
+                while (n+8 <= isize) {
+                    const int bend = std::min(n + block, isize - (isize & 7));
+                    __m256d sq0 = _mm256_setzero_pd();
+                    __m256d sq1 = _mm256_setzero_pd();
+                    for (; n+8 <= bend; n += 8) {
+                        if ((n & 63) == 0) {
+                            // Same rationale as the 512-bit tier: the
+                            // buffers were typically just written and
+                            // evicted, keep 16 lines of both in flight.
+                            _mm_prefetch(reinterpret_cast<const char*>(ref+n+256), _MM_HINT_NTA);
+                            _mm_prefetch(reinterpret_cast<const char*>(test+n+256), _MM_HINT_NTA);
+                        }
+                        __m256 d = _mm256_sub_ps(_mm256_loadu_ps(ref+n), _mm256_loadu_ps(test+n));
+                        __m256d dlo = _mm256_cvtps_pd(_mm256_castps256_ps128(d));
+                        __m256d dhi = _mm256_cvtps_pd(_mm256_extractf128_ps(d, 1));
+                        sq0 = _mm256_fmadd_pd(dlo, dlo, sq0);
+                        sq1 = _mm256_fmadd_pd(dhi, dhi, sq1);
+                        // alternate the max chains to keep them independent
+                        mx0 = _mm256_max_ps(mx0, _mm256_andnot_ps(signmask, d));
+                        std::swap(mx0, mx1);
+                    }
+                    const __m256d sq = _mm256_add_pd(sq0, sq1);
+                    __m128d s = _mm_add_pd(_mm256_castpd256_pd128(sq), _mm256_extractf128_pd(sq, 1));
+                    const double bsum = _mm_cvtsd_f64(_mm_add_sd(s, _mm_unpackhi_pd(s, s)));
+                    const double y = bsum - comp;
+                    const double t = ener + y;
+                    comp = (t - ener) - y;
+                    ener = t;
+                }
+                __m256 mx = _mm256_max_ps(mx0, mx1);
+                __m128 m = _mm_max_ps(_mm256_castps256_ps128(mx), _mm256_extractf128_ps(mx, 1));
+                m = _mm_max_ps(m, _mm_movehl_ps(m, m));
+                m = _mm_max_ss(m, _mm_movehdup_ps(m));
+                maxv = _mm_cvtss_f32(m);
+            #elif (defined(__ARM_NEON) || defined(__ARM_NEON__)) && defined(__aarch64__)
+                // Double accumulators for the same precision reason as the
+                // AVX2 path; no tiling needed once the lanes are double.
+                float64x2_t sq0 = vdupq_n_f64(0.0);
+                float64x2_t sq1 = vdupq_n_f64(0.0);
+                float32x4_t mx0 = vdupq_n_f32(0.0f);
+                float32x4_t mx1 = vdupq_n_f32(0.0f);
+                for (; n+8 <= isize; n += 8) {
+                    float32x4_t d0 = vsubq_f32(vld1q_f32(ref+n), vld1q_f32(test+n));
+                    float32x4_t d1 = vsubq_f32(vld1q_f32(ref+n+4), vld1q_f32(test+n+4));
+                    float64x2_t d0l = vcvt_f64_f32(vget_low_f32(d0));
+                    float64x2_t d0h = vcvt_high_f64_f32(d0);
+                    float64x2_t d1l = vcvt_f64_f32(vget_low_f32(d1));
+                    float64x2_t d1h = vcvt_high_f64_f32(d1);
+                    sq0 = vfmaq_f64(sq0, d0l, d0l);
+                    sq1 = vfmaq_f64(sq1, d0h, d0h);
+                    sq0 = vfmaq_f64(sq0, d1l, d1l);
+                    sq1 = vfmaq_f64(sq1, d1h, d1h);
+                    mx0 = vmaxq_f32(mx0, vabsq_f32(d0));
+                    mx1 = vmaxq_f32(mx1, vabsq_f32(d1));
+                }
+                ener = vaddvq_f64(vaddq_f64(sq0, sq1));
+                maxv = vmaxvq_f32(vmaxq_f32(mx0, mx1));
+            #endif
+            for (; n < isize; ++n) {
+                const double d = static_cast<double>(ref[n]) - test[n];
+                const double y = d*d - comp;
+                const double t = ener + y;
+                comp = (t - ener) - y;
+                ener = t;
+                maxv = std::max(maxv, phaseshift::fabsf_bits(ref[n] - test[n]));
+            }
+            ener /= isize;
+
+            return {std::sqrt(ener), maxv};
+        }
+
+        //! RMS and max absolute difference in a single pass: the two are
+        //! almost always requested together on the same buffers, and the
+        //! traversal is memory-bound, so fusing them halves the bytes moved.
         template<class datastruct_ref, class datastruct_test>
-        double signals_diff_ener(const datastruct_ref& ref, const datastruct_test& test) {
+        diff_stats signals_diff_stats(const datastruct_ref& ref, const datastruct_test& test) {
             if (ref.size() != test.size()) {
-                std::cerr << "ERROR: signals_diff_ener: Signals have different length: " << ref.size() << " vs. " << test.size() << std::endl;
-                return -1.0;
+                std::cerr << "ERROR: signals_diff_stats: Signals have different length: " << ref.size() << " vs. " << test.size() << std::endl;
+                return {-1.0, -1.0f};
             }
 
             if (ref.size() == 0) {
-                std::cerr << "ERROR: signals_diff_ener: Signals have zero length" << std::endl;
-                return -1.0;
+                std::cerr << "ERROR: signals_diff_stats: Signals have zero length" << std::endl;
+                return {-1.0, 0.0f};
             }
 
-            double ener = 0.0;
-            for (int n = 0; n < ref.size(); ++n) {
-                ener += (ref[n] - test[n]) * (ref[n] - test[n]);
+            if constexpr (has_contiguous_data<datastruct_ref>::value && has_contiguous_data<datastruct_test>::value
+                          && std::is_same_v<typename datastruct_ref::value_type, float>
+                          && std::is_same_v<typename datastruct_test::value_type, float>) {
+                return signals_diff_stats(ref.data(), test.data(), static_cast<size_t>(ref.size()));
+            } else {
+                // Deduce the element type of the difference: a float
+                // accumulator here would narrow every double diff back to
+                // float and block vectorization of the max chain.
+                using T = std::decay_t<decltype(ref[0] - test[0])>;
+                double ener = 0.0;
+                T maxv = T(0);
+                for (int n = 0; n < int(ref.size()); ++n) {
+                    const T d = ref[n] - test[n];
+                    ener += static_cast<double>(d) * d;
+                    maxv = std::max(maxv, std::abs(d));
+                }
+                ener /= ref.size();
+                return {std::sqrt(ener), static_cast<float>(maxv)};
             }
-            ener /= ref.size();
-            ener = std::sqrt(ener);
+        }
 
-            return ener;
+        inline double signals_diff_ener(const float* PHASESHIFT_RESTRICT ref, const float* PHASESHIFT_RESTRICT test, size_t size) {
+            return signals_diff_stats(ref, test, size).rms;
+        }
+        inline double signals_diff_max(const float* PHASESHIFT_RESTRICT ref, const float* PHASESHIFT_RESTRICT test, size_t size) {
+            return signals_diff_stats(ref, test, size).max_abs;
+        }
+        template<class datastruct_ref, class datastruct_test>
+        double signals_diff_ener(const datastruct_ref& ref, const datastruct_test& test) {
+            return signals_diff_stats(ref, test).rms;
         }
         template<class datastruct_ref, class datastruct_test>
         double signals_diff_max(const datastruct_ref& ref, const datastruct_test& test) {
-            if (ref.size() != test.size()) {
-                std::cerr << "ERROR: signals_diff_max: Signals have different length: " << ref.size() << " vs. " << test.size() << std::endl;
-                return -1.0;
-            }
-
-            float maxv = 0.0f;
-            for (int n = 0; n < ref.size(); ++n) {
-                maxv = std::max(maxv, std::abs(ref[n] - test[n]));
-            }
-
-            return maxv;
+            return signals_diff_stats(ref, test).max_abs;
         }
 
         template<class datastruct>
         void signals_check_nan_inf(const datastruct& data) {
             #ifndef NDEBUG
-            for (int n=0; n<data.size(); ++n) {
+            int n = 0;
+            #if defined(__AVX2__)
+                if constexpr (has_contiguous_data<datastruct>::value
+                              && std::is_same_v<typename datastruct::value_type, float>) {
+                    // A float is NaN or Inf iff its exponent field is all
+                    // ones, so the scan reduces to comparing
+                    // bits & 0x7f800000 over 8 lanes with one movemask
+                    // branch per vector: the clean path never goes scalar.
+                    const float* p = data.data();
+                    const int size = static_cast<int>(data.size());
+                    const __m256i expmask = _mm256_set1_epi32(0x7f800000);
+                    for (; n+8 <= size; n += 8) {
+                        // The producer has usually just written these
+                        // samples past the L1/L2, so the re-read stalls on
+                        // memory: fetch 16 lines ahead, non-temporal since
+                        // validation touches each sample once. Prefetch
+                        // never faults, so no end-of-buffer guard.
+                        if ((n & 63) == 0)
+                            _mm_prefetch(reinterpret_cast<const char*>(p+n+256), _MM_HINT_NTA);
+                        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p+n));
+                        __m256i bad = _mm256_cmpeq_epi32(_mm256_and_si256(v, expmask), expmask);
+                        if (_mm256_movemask_epi8(bad)) {
+                            // Rerun the offending vector per lane so the
+                            // assert points at the exact sample.
+                            for (int l = n; l < n+8; ++l) {
+                                assert(!std::isnan(data[l]));
+                                assert(!std::isinf(data[l]));
+                            }
+                        }
+                    }
+                }
+            #endif
+            for (; n<data.size(); ++n) {
                 assert(!std::isnan(data[n]));
                 assert(!std::isinf(data[n]));
             }